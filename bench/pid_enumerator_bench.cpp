@@ -0,0 +1,103 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+// Compares Util::getFileList + lexicalCast + isDir with PidEnumerator on a
+// synthetic sysroot with 5k pid dirs.
+//
+
+#include "util.h"
+#include "pid_enumerator.h"
+
+using namespace yoda;
+
+static const uint32_t pidCount = 5000;
+static const uint32_t loopCount = 200;
+
+static std::string makeSysroot() {
+  char tmpl[] = "/tmp/yoda-bench-proc-XXXXXX";
+  ASSERT(mkdtemp(tmpl), "mkdtemp failed: %s", strerror(errno));
+  std::string dir(tmpl);
+  for (uint32_t pid = 1; pid <= pidCount; ++pid) {
+    std::string pidDir = dir + "/" + std::to_string(pid * 3);
+    mkdir(pidDir.c_str(), 0755);
+  }
+  // non pid entries of a real /proc
+  const char *dirs[] = {"self", "sys", "net", "irq", "1a", "0x10"};
+  for (auto name : dirs) {
+    mkdir((dir + "/" + name).c_str(), 0755);
+  }
+  const char *files[] = {"stat", "meminfo", "vmstat", "12345678", "42"};
+  for (auto name : files) {
+    FILE *fp = fopen((dir + "/" + name).c_str(), "w");
+    if (fp) {
+      fclose(fp);
+    }
+  }
+  return dir;
+}
+
+static void removeSysroot(const std::string &dir) {
+  Util::exec("rm -rf " + dir);
+}
+
+static uint64_t nowUs() {
+  timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t scanLegacy(const std::string &dir) {
+  uint32_t count = 0;
+  std::vector<std::string> files(Util::getFileList(dir));
+  for (auto &file : files) {
+    uint32_t pid;
+    if (Util::lexicalCast<uint32_t>(file, &pid)) {
+      std::string pidDir(dir);
+      pidDir += "/" + file;
+      if (Util::isDir(pidDir)) {
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+static uint32_t scanEnumerator(PidEnumerator &enumerator,
+                               const std::string &dir) {
+  uint32_t count = 0;
+  uint32_t pid;
+  enumerator.open(dir);
+  while (enumerator.next(&pid)) {
+    ++count;
+  }
+  enumerator.close();
+  return count;
+}
+
+int main() {
+  std::string dir = makeSysroot();
+  PidEnumerator enumerator;
+  uint32_t legacyCount = scanLegacy(dir);
+  uint32_t enumCount = scanEnumerator(enumerator, dir);
+  printf("sysroot %s, pids: legacy %u, enumerator %u\n",
+         dir.c_str(), legacyCount, enumCount);
+
+  uint64_t start = nowUs();
+  for (uint32_t i = 0; i < loopCount; ++i) {
+    scanLegacy(dir);
+  }
+  uint64_t legacyUs = (nowUs() - start) / loopCount;
+
+  start = nowUs();
+  for (uint32_t i = 0; i < loopCount; ++i) {
+    scanEnumerator(enumerator, dir);
+  }
+  uint64_t enumUs = (nowUs() - start) / loopCount;
+
+  printf("getFileList+lexicalCast+isDir: %" PRIu64 " us/scan\n", legacyUs);
+  printf("PidEnumerator:                 %" PRIu64 " us/scan\n", enumUs);
+  printf("speedup: %.1fx\n", enumUs ? (double) legacyUs / enumUs : 0.0);
+
+  removeSysroot(dir);
+  return legacyCount == enumCount ? 0 : 1;
+}
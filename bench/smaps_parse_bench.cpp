@@ -0,0 +1,121 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+// Measures smaps parse throughput of the fgets getProcessSmap against the
+// chunked SmapsParser, on the sample/proc/*/smaps fixtures repeated 1000
+// times, or the given count of times.
+//
+
+#include "util.h"
+#include "busy_box.h"
+#include <dirent.h>
+
+using namespace yoda;
+
+static const uint32_t loopCount = 5;
+
+static std::string readFile(const std::string &path) {
+  std::string content;
+  FILE *fp = fopen(path.c_str(), "r");
+  ASSERT(fp, "open %s failed: %s", path.c_str(), strerror(errno));
+  char buf[4096];
+  size_t size;
+  while ((size = fread(buf, 1, sizeof(buf), fp)) > 0) {
+    content.append(buf, size);
+  }
+  fclose(fp);
+  return content;
+}
+
+/*
+ * copies every sample pid dir with its smaps repeated scale times, returns
+ * the pids
+ */
+static std::vector<uint32_t> makeProcDir(const std::string &dir,
+                                         uint32_t scale) {
+  std::vector<uint32_t> pids;
+  std::string sampleDir = SAMPLE_PROC_DIR;
+  DIR *procDir = opendir(sampleDir.c_str());
+  ASSERT(procDir, "open %s failed: %s", sampleDir.c_str(), strerror(errno));
+  dirent *entry;
+  while ((entry = readdir(procDir)) != nullptr) {
+    char *end;
+    auto pid = (uint32_t) strtoul(entry->d_name, &end, 10);
+    std::string smapsFile = sampleDir + "/" + entry->d_name + "/smaps";
+    if (*end != '\0' || access(smapsFile.c_str(), R_OK) != 0) {
+      continue;
+    }
+    std::string smaps = readFile(smapsFile);
+    // the fixtures are cut at the last line
+    if (!smaps.empty() && smaps.back() != '\n') {
+      smaps.push_back('\n');
+    }
+    std::string pidDir = dir + "/" + entry->d_name;
+    mkdir(pidDir.c_str(), 0755);
+    FILE *fp = fopen((pidDir + "/smaps").c_str(), "w");
+    ASSERT(fp, "open %s/smaps failed: %s", pidDir.c_str(), strerror(errno));
+    for (uint32_t i = 0; i < scale; ++i) {
+      fwrite(smaps.data(), 1, smaps.size(), fp);
+    }
+    fclose(fp);
+    pids.push_back(pid);
+  }
+  closedir(procDir);
+  return pids;
+}
+
+static uint64_t nowUs() {
+  timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint64_t fileSize(const std::string &path) {
+  struct stat st = {};
+  stat(path.c_str(), &st);
+  return (uint64_t) st.st_size;
+}
+
+int main(int argc, char **argv) {
+  uint32_t scale = argc > 1 ? (uint32_t) strtoul(argv[1], nullptr, 10) : 1000;
+  char tmpl[] = "/tmp/yoda-bench-smaps-XXXXXX";
+  ASSERT(mkdtemp(tmpl), "mkdtemp failed: %s", strerror(errno));
+  std::string dir(tmpl);
+  auto pids = makeProcDir(dir, scale);
+  ASSERT(!pids.empty(), "no smaps in %s", SAMPLE_PROC_DIR);
+
+  SmapsParser parser;
+  for (auto pid : pids) {
+    std::string pidDir = dir + "/" + std::to_string(pid);
+    uint64_t bytes = fileSize(pidDir + "/smaps");
+    auto legacy = busybox::getProcessSmap(pidDir, pid);
+    auto stream = busybox::getProcessSmap(pidDir, pid, parser);
+    ASSERT(legacy && stream, "parse %s failed", pidDir.c_str());
+    ASSERT(legacy->pss == stream->pss && legacy->rss == stream->rss &&
+           legacy->swap == stream->swap && legacy->size == stream->size &&
+           legacy->rw == stream->rw && legacy->ro == stream->ro &&
+           legacy->stack == stream->stack &&
+           legacy->private_dirty == stream->private_dirty &&
+           legacy->private_clean == stream->private_clean &&
+           legacy->shared_dirty == stream->shared_dirty &&
+           legacy->shared_clean == stream->shared_clean,
+           "pid %u: parsers disagree", pid);
+
+    uint64_t legacyUs = UINT64_MAX;
+    uint64_t streamUs = UINT64_MAX;
+    for (uint32_t i = 0; i < loopCount; ++i) {
+      uint64_t start = nowUs();
+      busybox::getProcessSmap(pidDir, pid);
+      legacyUs = std::min(legacyUs, nowUs() - start);
+      start = nowUs();
+      busybox::getProcessSmap(pidDir, pid, parser);
+      streamUs = std::min(streamUs, nowUs() - start);
+    }
+    printf("pid %u x%u, %.1f MB: fgets %.1f MB/s, chunked %.1f MB/s\n",
+           pid, scale, bytes / 1000000.0,
+           bytes / (double) std::max(legacyUs, (uint64_t) 1),
+           bytes / (double) std::max(streamUs, (uint64_t) 1));
+  }
+  Util::exec("rm -rf " + dir);
+  return 0;
+}
@@ -0,0 +1,97 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+// Measures getSystemTop tick latency against topScanThreads, on a
+// synthetic proc dir with 5k processes, or on the given proc dir.
+// Every thread count runs in a forked child as the scan threads can only
+// be set before the first sample.
+//
+
+#include "util.h"
+#include "busy_box.h"
+#include <sys/wait.h>
+
+using namespace yoda;
+
+static const uint32_t pidCount = 5000;
+static const uint32_t loopCount = 50;
+static const uint32_t threadCounts[] = {1, 2, 4, 8};
+
+static void writeFile(const std::string &path, const std::string &content) {
+  FILE *fp = fopen(path.c_str(), "w");
+  ASSERT(fp, "open %s failed: %s", path.c_str(), strerror(errno));
+  fwrite(content.data(), 1, content.size(), fp);
+  fclose(fp);
+}
+
+static std::string makeProcDir() {
+  char tmpl[] = "/tmp/yoda-bench-proc-XXXXXX";
+  ASSERT(mkdtemp(tmpl), "mkdtemp failed: %s", strerror(errno));
+  std::string dir(tmpl);
+  writeFile(dir + "/stat",
+            "cpu  23885 0 4852 52746 0 0 212 0 0 0\n"
+            "cpu0 23885 0 4852 52746 0 0 212 0 0 0\n"
+            "ctxt 2057621\n"
+            "processes 4184\n");
+  char stat[512];
+  for (uint32_t pid = 1; pid <= pidCount; ++pid) {
+    std::string pidDir = dir + "/" + std::to_string(pid);
+    mkdir(pidDir.c_str(), 0755);
+    snprintf(stat, sizeof(stat),
+             "%u (worker-%u) S 1 %u %u 0 -1 4194560 120 0 0 0 %u %u 0 0 20 0 "
+             "1 0 %u 12713984 1024 18446744073709551615 1 1 0 0 0 0 0 4096 "
+             "0 0 0 0 17 %u 0 0 0 0 0 0 0 0 0 0 0 0 0\n",
+             pid, pid, pid, pid, pid * 7, pid * 3, 1000 + pid, pid % 4);
+    writeFile(pidDir + "/stat", stat);
+    static const char cmdline[] = "/usr/bin/worker\0--id\0";
+    writeFile(pidDir + "/cmdline", std::string(cmdline, sizeof(cmdline) - 1) +
+                                   std::to_string(pid));
+  }
+  return dir;
+}
+
+static uint64_t nowUs() {
+  timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void runTicks(const std::string &dir, uint32_t threads) {
+  auto &sampler = busybox::topSampler();
+  sampler.setProcFdCache(true);
+  sampler.setScanThreads(threads, 0);
+  size_t processes = sampler.sample(dir)->processes->size();
+  uint64_t total = 0;
+  uint64_t max = 0;
+  for (uint32_t i = 0; i < loopCount; ++i) {
+    uint64_t start = nowUs();
+    sampler.sample(dir);
+    uint64_t cost = nowUs() - start;
+    total += cost;
+    max = std::max(max, cost);
+  }
+  printf("threads %u, %zu processes: %" PRIu64 " us/tick avg, %" PRIu64
+         " us max\n", threads, processes, total / loopCount, max);
+}
+
+int main(int argc, char **argv) {
+  bool synthetic = argc < 2;
+  std::string dir = synthetic ? makeProcDir() : argv[1];
+  printf("proc dir %s\n", dir.c_str());
+  for (auto threads : threadCounts) {
+    fflush(stdout);
+    pid_t child = fork();
+    ASSERT(child >= 0, "fork failed: %s", strerror(errno));
+    if (child == 0) {
+      runTicks(dir, threads);
+      fflush(stdout);
+      _exit(0);
+    }
+    int status;
+    waitpid(child, &status, 0);
+  }
+  if (synthetic) {
+    Util::exec("rm -rf " + dir);
+  }
+  return 0;
+}
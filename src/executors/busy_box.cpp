@@ -3,18 +3,24 @@
 //
 
 #include "busy_box.h"
+#include "proc_fd_cache.h"
+#include "proc_identity_cache.h"
 #include "util.h"
+#include <algorithm>
 
 #define PROCPS_BUFSIZE 1024
-#define LINE_BUF_SIZE 512
+#define CMDLINE_BUFSIZE (1024 + 1)
+#define STATUS_BUFSIZE 4096
+#define SCHEDSTAT_BUFSIZE 64
+#define SMAPS_ROLLUP_BUFSIZE 2048
 
 namespace {
 
-std::string parseCmdline(const std::string &cmdlinePath) {
-  std::string cmdline = yoda::Util::readSmallFile(cmdlinePath);
+std::string parseCmdline(const char *cmdline, size_t size) {
   std::string output;
   bool ignore0 = false;
-  for (auto &c : cmdline) {
+  for (size_t i = 0; i < size; ++i) {
+    char c = cmdline[i];
     if (c == '\0') {
       // skip consecutive '\0'
       if (!ignore0) {
@@ -29,6 +35,11 @@ std::string parseCmdline(const std::string &cmdlinePath) {
   return output;
 }
 
+std::string parseCmdline(const std::string &cmdlinePath) {
+  std::string cmdline = yoda::Util::readSmallFile(cmdlinePath);
+  return parseCmdline(cmdline.data(), cmdline.size());
+}
+
 int index_in_strings(const char *strings, const char *key) {
   int idx = 0;
 
@@ -122,50 +133,167 @@ T fast_strtoul_10(char **endptr) {
   return n;
 }
 
-static std::map<int32_t, std::shared_ptr<ProcessTopInfo>> processesJif;
-static std::shared_ptr<SystemCPUInfo> cpuTotalJif(nullptr);
-static std::shared_ptr<SystemCPUInfo> cpuTotalPrevJif(nullptr);
-static std::vector<std::shared_ptr<SystemCPUInfo>> cpuCoresJif;
-static std::vector<std::shared_ptr<SystemCPUInfo>> cpuCoresPrevJif;
-static char line_buf[LINE_BUF_SIZE] = {0};
-
 }
 
 namespace busybox {
 
-std::shared_ptr<ProcessTopInfo> getProcessTopCache(uint32_t pid) {
-  auto ite = processesJif.find(pid);
-  if (ite == processesJif.end()) {
-    return nullptr;
+/*
+ * sampler state of one scan thread. Pids are sharded by pid % shard count,
+ * so a process keeps its cached fds and identity in the same shard
+ */
+struct TopSampler::ScanShard {
+  std::unique_ptr<yoda::ProcFdCache> fdCache;
+  yoda::ProcIdentityCache identityCache;
+  std::vector<uint32_t> pids;
+  // pids whose stat is gone
+  std::vector<uint32_t> gone;
+  yoda::ProcessTable processes;
+  uint64_t tickTotal = 0;
+  uint32_t skipped = 0;
+  // the scan starts at this pid or the next greater one, the first pid
+  // skipped last tick
+  uint32_t resumePid = 0;
+};
+
+TopSampler::TopSampler() : _published(nullptr),
+                           _last(new yoda::ProcessTable),
+                           _spare(nullptr),
+                           _vanished(),
+                           _cpuTotalJif(nullptr),
+                           _cpuTotalPrevJif(nullptr),
+                           _cpuCoresJif(),
+                           _cpuCoresPrevJif(),
+                           _procStat(nullptr),
+                           _fdPersistent(false),
+                           _schedStat(false),
+                           _shards(),
+                           _shardCount(1),
+                           _scanWindowMs(0),
+                           _workers(),
+                           _scanTable(nullptr),
+                           _scanDeadline(0),
+                           _lastSampleTime(0),
+                           _prevSampleTime(0),
+                           _tickSeconds(0.0f),
+                           _pidEnumerator(),
+                           _connector(nullptr),
+                           _reconcileTicks(0),
+                           _ticksSinceScan(0),
+                           _pids(),
+                           _exits() {
+
+}
+
+TopSampler::~TopSampler() {
+  _workers.stop();
+}
+
+TopSampler &topSampler() {
+  static TopSampler sampler;
+  return sampler;
+}
+
+void TopSampler::setProcFdCache(bool persistent) {
+  _fdPersistent = persistent;
+  for (auto &shard : _shards) {
+    shard->fdCache->setPersistent(persistent);
   }
-  return ite->second;
 }
 
-std::shared_ptr<ProcessTopInfo>
-getProcessTop(const std::string &dir, uint32_t pid) {
-  std::string buf(yoda::Util::readSmallFile(dir + "/stat"));
-  if (buf.empty()) {
+void TopSampler::setSchedStat(bool enable) {
+  _schedStat = enable;
+}
+
+void TopSampler::setScanThreads(uint32_t threads, uint32_t windowMs) {
+  if (!_shards.empty()) {
+    LOG_WARN("scan threads are only set before the first sample");
+    return;
+  }
+  _workers.stop();
+  _shardCount = threads > 0 ? threads : 1;
+  _scanWindowMs = windowMs;
+  _workers.start(_shardCount);
+}
+
+void TopSampler::setProcConnector(
+  const std::shared_ptr<yoda::ProcConnector> &connector,
+  uint32_t reconcileTicks) {
+  _connector = connector;
+  _reconcileTicks = reconcileTicks;
+  _ticksSinceScan = 0;
+  _vanished.clear();
+}
+
+std::shared_ptr<const yoda::ProcessTable> TopSampler::snapshot() const {
+  return std::atomic_load(&_published);
+}
+
+std::shared_ptr<ProcessTopInfo> TopSampler::findProcess(uint32_t pid) const {
+  auto processes = this->snapshot();
+  if (!processes) {
+    return nullptr;
+  }
+  int64_t row = processes->find(pid);
+  if (row < 0) {
     return nullptr;
   }
-  std::shared_ptr<ProcessTopInfo> stat(new ProcessTopInfo);
+  std::shared_ptr<ProcessTopInfo> process(new ProcessTopInfo);
+  processes->get((size_t) row, *process);
+  return process;
+}
+
+std::shared_ptr<const ProcessIdentity>
+TopSampler::processIdentity(ScanShard &shard, uint32_t pid,
+                            uint64_t startTime, const char *comm,
+                            size_t commLen) {
+  auto identity = shard.identityCache.find(pid, startTime, comm, commLen);
+  if (identity) {
+    return identity;
+  }
+  std::shared_ptr<ProcessIdentity> created(new ProcessIdentity);
+  created->startTime = startTime;
+  created->comm.assign(comm, commLen);
+  char cmdline[CMDLINE_BUFSIZE];
+  ssize_t size = shard.fdCache->readOnce(pid, "cmdline", cmdline,
+                                         sizeof(cmdline));
+  if (size > 0) {
+    created->cmdline = parseCmdline(cmdline, (size_t) size);
+  }
+  created->fullname = created->cmdline.empty() ?
+                      created->comm : created->cmdline;
+  yoda::Util::replaceChar(created->fullname, "\r\n", ' ');
+  shard.identityCache.insert(pid, created);
+  return created;
+}
+
+/*
+ * buf is the content of /proc/<pid>/stat
+ */
+bool TopSampler::parseProcessTop(ScanShard &shard, uint32_t pid, char *buf,
+                                 ProcessTopInfo &info) {
+  char *commStart = strchr(buf, '(');
+  /* comm may contain ')', the last one ends it */
+  char *commEnd = strrchr(buf, ')');
+  if (!commStart || !commEnd || commEnd < commStart) {
+    return false;
+  }
+  ProcessTopInfo *stat = &info;
   stat->pid = pid;
-  size_t commStart = buf.find_first_of('(');
-  size_t commEnd = buf.find_first_of(')');
-  stat->comm = buf.substr(commStart + 1, commEnd - commStart - 1);
-  stat->cmdline = parseCmdline(dir + "/cmdline");
-  stat->fullname = stat->cmdline.empty() ? stat->comm : stat->cmdline;
-  yoda::Util::replaceChar(stat->fullname, "\r\n", ' ');
   memset(stat->state  , '\0', sizeof(stat->state));
-  stat->state[0] = buf.at(commEnd + 2);
+  stat->state[0] = commEnd[2];
 
-  char *cp = &buf[0] + commEnd + 4;
+  char *cp = commEnd + 4;
   stat->ppid = (uint32_t) fast_strtoul_10(&cp);
   stat->pgid = (uint32_t) fast_strtoul_10(&cp);
   stat->sid = (uint32_t) fast_strtoul_10(&cp);
   auto tty = (int32_t) fast_strtoul_10(&cp);
   stat->ttyMajor = (uint32_t) (tty >> 8) & 0xfff;
   stat->ttyMinor = (uint32_t) (tty & 0xff) | ((tty >> 12) & 0xfff00);
-  cp = skip_fields(cp, 6); /* tpgid, flags, min_flt, cmin_flt, maj_flt, cmaj_flt */
+  cp = skip_fields(cp, 2); /* tpgid, flags */
+  stat->minFlt = fast_strtoul_10(&cp);
+  cp = skip_fields(cp, 1); /* cmin_flt */
+  stat->majFlt = fast_strtoul_10(&cp);
+  cp = skip_fields(cp, 1); /* cmaj_flt */
   stat->utime = fast_strtoul_10(&cp);
   stat->stime = fast_strtoul_10(&cp);
   stat->ticks = stat->utime + stat->stime;
@@ -173,6 +301,10 @@ getProcessTop(const std::string &dir, uint32_t pid) {
   stat->nice = (*cp == '-' ? ++cp, -1 : 1) * fast_strtoul_10(&cp);
   cp = skip_fields(cp, 2); /* timeout, it_real_value */
   stat->startTime = fast_strtoul_10(&cp);
+  shard.fdCache->bind(pid, stat->startTime);
+  stat->identity = this->processIdentity(shard, pid, stat->startTime,
+                                         commStart + 1,
+                                         commEnd - commStart - 1);
   /* vsz is in bytes and we want kb */
   stat->vsz = fast_strtoul_10(&cp) >> 10;
   /* vsz is in bytes but rss is in *PAGES*! Can you believe that? */
@@ -195,26 +327,128 @@ getProcessTop(const std::string &dir, uint32_t pid) {
     stat->state[s_idx] = stat->nice < 0 ? '<' : 'N';
   }
 
-  return stat;
+  stat->ticksDelta = 0;
+  stat->cpuUsagePercent = 0.0f;
+  stat->hasSwitches = false;
+  stat->nvcsw = 0;
+  stat->nivcsw = 0;
+  stat->minFltRate = 0.0f;
+  stat->majFltRate = 0.0f;
+  stat->nvcswRate = 0.0f;
+  stat->nivcswRate = 0.0f;
+  stat->hasSchedStat = false;
+  stat->runTime = 0;
+  stat->waitTime = 0;
+  stat->timeslices = 0;
+  stat->runDelta = 0;
+  stat->waitDelta = 0;
+  stat->timeslicesDelta = 0;
+  return true;
+}
+
+/*
+ * /proc/<pid>/schedstat: ns on cpu, ns waiting on a runqueue, timeslices
+ */
+bool TopSampler::readSchedStat(ScanShard &shard, uint32_t pid,
+                               ProcessTopInfo &info) {
+  char buf[SCHEDSTAT_BUFSIZE];
+  if (shard.fdCache->read(pid, yoda::ProcFile::SCHEDSTAT, buf,
+                          sizeof(buf)) <= 0) {
+    return false;
+  }
+  char *cp = buf;
+  info.runTime = fast_strtoul_10(&cp);
+  info.waitTime = fast_strtoul_10(&cp);
+  info.timeslices = fast_strtoul_10(&cp);
+  info.hasSchedStat = true;
+  return true;
+}
+
+/*
+ * voluntary_ctxt_switches:        150
+ * nonvoluntary_ctxt_switches:     545
+ *
+ * the last lines of /proc/<pid>/status
+ */
+bool TopSampler::readSwitches(ScanShard &shard, uint32_t pid,
+                              ProcessTopInfo &info) {
+  char buf[STATUS_BUFSIZE];
+  if (shard.fdCache->read(pid, yoda::ProcFile::STATUS, buf,
+                          sizeof(buf)) <= 0) {
+    return false;
+  }
+  char *voluntary = strstr(buf, "\nvoluntary_ctxt_switches:");
+  char *nonvoluntary = strstr(buf, "\nnonvoluntary_ctxt_switches:");
+  if (!voluntary || !nonvoluntary) {
+    return false;
+  }
+  voluntary = skip_whitespace(strchr(voluntary, ':') + 1);
+  nonvoluntary = skip_whitespace(strchr(nonvoluntary, ':') + 1);
+  info.nvcsw = fast_strtoul_10(&voluntary);
+  info.nivcsw = fast_strtoul_10(&nonvoluntary);
+  info.hasSwitches = true;
+  return true;
+}
+
+void TopSampler::initScanShards(const std::string &dir) {
+  if (!_shards.empty()) {
+    return;
+  }
+  for (size_t i = 0; i < _shardCount; ++i) {
+    std::unique_ptr<ScanShard> shard(new ScanShard);
+    shard->fdCache.reset(new yoda::ProcFdCache(dir));
+    shard->fdCache->setMaxFds(shard->fdCache->maxFds() / _shardCount);
+    shard->fdCache->setPersistent(_fdPersistent);
+    _shards.emplace_back(std::move(shard));
+  }
+}
+
+bool TopSampler::readProcessTop(ScanShard &shard, uint32_t pid,
+                                ProcessTopInfo &info) {
+  char buf[PROCPS_BUFSIZE];
+  if (shard.fdCache->read(pid, yoda::ProcFile::STAT, buf, sizeof(buf)) <= 0) {
+    return false;
+  }
+  return this->parseProcessTop(shard, pid, buf, info);
+}
+
+std::shared_ptr<ProcessTopInfo>
+TopSampler::sampleProcess(const std::string &dir, uint32_t pid) {
+  this->initScanShards(dir);
+  std::shared_ptr<ProcessTopInfo> process(new ProcessTopInfo);
+  if (!this->readProcessTop(this->shardOf(pid), pid, *process)) {
+    return nullptr;
+  }
+  return process;
 }
 
 #define SCAN(S, X) \
   if ((tp = is_prefixed_with(buf, S)) != nullptr) {         \
     tp = skip_whitespace(tp);                               \
     total->X += currec->X = fast_strtoul_10(&tp);           \
-    /*if (currec->X > 0) {                                    \
-      auto ite = total->sections.find(currec->fullname);   \
-      if (ite == total->sections.end()) {                   \
-        total->sections.insert({currec->fullname, currec});\
-      } else {                                              \
-        ite->second->X += currec->X;                        \
-      }                                                     \
-    } */                                                     \
     continue;                                               \
   }
 
+static std::shared_ptr<ProcessSmapInfo> newProcessSmap(const std::string &dir,
+                                                       uint32_t pid) {
+  std::shared_ptr<ProcessSmapInfo> total(new ProcessSmapInfo);
+  total->pid = pid;
+  total->comm = yoda::Util::readSmallFile(dir + "/comm");
+  total->cmdline = parseCmdline(dir + "/cmdline");
+  total->fullname = total->cmdline.empty() ? total->comm : total->cmdline;
+  return total;
+}
+
+static inline void addSmapFile(yoda::SmapFileTable *files, uint32_t fileId,
+                               uint32_t pid, const ProcessSmapInfo &rec) {
+  if (files && fileId != UINT32_MAX) {
+    files->add(fileId, pid, rec.pss, rec.rss, rec.swap);
+  }
+}
+
 std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
-                                                uint32_t pid) {
+                                                uint32_t pid,
+                                                yoda::SmapFileTable *files) {
   std::string filename = dir + "/smaps";
   char buf[PROCPS_BUFSIZE];
 
@@ -222,12 +456,10 @@ std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
   if (!file) {
     return nullptr;
   }
-  std::shared_ptr<ProcessSmapInfo> total(new ProcessSmapInfo);
-  total->pid = pid;
-  total->comm = yoda::Util::readSmallFile(dir + "/comm");
-  total->cmdline = parseCmdline(dir + "/cmdline");
-  total->fullname = total->cmdline.empty() ? total->comm : total->cmdline;
+  auto total = newProcessSmap(dir, pid);
   std::shared_ptr<ProcessSmapInfo> currec(new ProcessSmapInfo);
+  // the interned path of currec
+  uint32_t fileId = UINT32_MAX;
 
   while (fgets(buf, PROCPS_BUFSIZE, file)) {
     // Each mapping datum has this form:
@@ -250,6 +482,7 @@ std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
       // We reached next mapping - the line of this form:
       // f7d29000-f7d39000 rw-s FILEOFS M:m INODE FILENAME
 
+      addSmapFile(files, fileId, pid, *currec);
       currec = std::make_shared<ProcessSmapInfo>();
 
       *tp = ' ';
@@ -259,8 +492,13 @@ std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
 
       strncpy(currec->smap_mode, tp, sizeof(currec->smap_mode) - 1);
 
-      // skipping "rw-s FILEOFS M:m INODE "
-      tp = skip_whitespace(skip_fields(tp, 4));
+      // skipping "rw-s FILEOFS M:m INODE ", older kernels end anon
+      // mappings right after INODE
+      for (int i = 0; i < 4; ++i) {
+        p = strchr(tp, ' ');
+        tp = p ? p + 1 : tp + strlen(tp);
+      }
+      tp = skip_whitespace(tp);
       // filter out /dev/something (something != zero)
       if (!is_prefixed_with(tp, "/dev/") || strcmp(tp, "/dev/zero\n") == 0) {
         if (currec->smap_mode[1] == 'w') {
@@ -282,14 +520,119 @@ std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
         *p = '\0';
         currec->fullname = tp;
       }
+      if (files) {
+        fileId = p == tp ? files->intern("[anon]", 6)
+                         : files->intern(tp, p - tp);
+      }
       total->size += currec->size;
     }
   }
+  addSmapFile(files, fileId, pid, *currec);
   fclose(file);
 
   return total;
 }
 
+std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
+                                                uint32_t pid,
+                                                yoda::SmapsParser &parser,
+                                                yoda::SmapFileTable *files) {
+  int fd = open((dir + "/smaps").c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+  auto total = newProcessSmap(dir, pid);
+  bool ok = parser.parse(fd, *total, files);
+  close(fd);
+  return ok ? total : nullptr;
+}
+
+bool getSmapSignals(const std::string &dir, uint64_t *rss,
+                    uint32_t *mapsLines) {
+  char buf[PROCPS_BUFSIZE];
+  if (rss) {
+    // size resident shared text lib data dt, in pages
+    int fd = open((dir + "/statm").c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+    ssize_t size = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    if (size <= 0) {
+      return false;
+    }
+    buf[size] = '\0';
+    char *cp = skip_whitespace(skip_fields(buf, 1));
+    *rss = fast_strtoul_10(&cp) << get_shift_pages_to_kb();
+  }
+  // one line per mapping, far shorter than the smaps record of it
+  int fd = open((dir + "/maps").c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  uint32_t lines = 0;
+  ssize_t size;
+  while ((size = read(fd, buf, sizeof(buf))) > 0) {
+    for (const char *p = buf, *end = buf + size;
+         (p = (const char *) memchr(p, '\n', end - p)) != nullptr; ++p) {
+      ++lines;
+    }
+  }
+  close(fd);
+  if (size < 0) {
+    return false;
+  }
+  *mapsLines = lines;
+  return true;
+}
+
+bool hasSmapsRollup(const std::string &procDir) {
+  // linux 4.14+
+  return access((procDir + "/self/smaps_rollup").c_str(), R_OK) == 0;
+}
+
+std::shared_ptr<ProcessSmapInfo> getProcessSmapRollup(const std::string &dir,
+                                                      uint32_t pid) {
+  std::string filename = dir + "/smaps_rollup";
+  char data[SMAPS_ROLLUP_BUFSIZE];
+
+  int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+  ssize_t size = read(fd, data, sizeof(data) - 1);
+  close(fd);
+  if (size <= 0) {
+    return nullptr;
+  }
+  data[size] = '\0';
+  auto total = newProcessSmap(dir, pid);
+  // the sums of all mappings, there is no mapping to keep
+  std::shared_ptr<ProcessSmapInfo> currec(new ProcessSmapInfo);
+
+  // 00400000-ffffff601000 ---p 00000000 00:00 0    [rollup]
+  // Rss:                 nnn kB
+  // .....
+  char *next;
+  for (char *buf = data; buf && *buf; buf = next) {
+    next = strchr(buf, '\n');
+    if (next) {
+      *next++ = '\0';
+    }
+    char *tp;
+
+    SCAN("Pss:", pss);
+    SCAN("Swap:", swap);
+    SCAN("Rss:", rss);
+    SCAN("Private_Dirty:", private_dirty);
+    SCAN("Private_Clean:", private_clean);
+    SCAN("Shared_Dirty:", shared_dirty);
+    SCAN("Shared_Clean:", shared_clean);
+  }
+
+  return total;
+}
+
 std::shared_ptr<SystemMemoryInfo> getSystemMemory(const std::string &dir) {
   static const char *fields =
     "MemTotal\0"
@@ -323,86 +666,348 @@ std::shared_ptr<SystemMemoryInfo> getSystemMemory(const std::string &dir) {
 #define CAL_PERCENT_1000(num, deno)\
   ((deno) ? std::floor(1000.0f * (num) / (deno)) / 10.0f : 0)
 
-std::shared_ptr<SystemTopInfo> getSystemTop(const std::string &dir) {
+/*
+ * pids to sample in this tick, from the proc connector if it has not lost
+ * events, otherwise from a full scan of the proc dir
+ */
+bool TopSampler::collectPids(const std::string &dir) {
+  if (_connector && _connector->isRunning() &&
+      ++_ticksSinceScan < _reconcileTicks &&
+      _connector->snapshot(_pids)) {
+    return false;
+  }
+  _ticksSinceScan = 0;
+  if (_connector) {
+    _connector->beginScan();
+  }
+  _pids.clear();
+  uint32_t pid;
+  _pidEnumerator.open(dir);
+  while (_pidEnumerator.next(&pid)) {
+    _pids.push_back(pid);
+  }
+  _pidEnumerator.close();
+  if (_connector) {
+    _connector->endScan(_pids);
+  }
+  return true;
+}
+
+/*
+ * the last sample of the process, the pid may have been reused
+ */
+bool TopSampler::findLast(uint32_t pid, uint64_t startTime,
+                          const yoda::ProcessTable **last,
+                          size_t *row) const {
+  const yoda::ProcessTable *tables[] = {_last.get(), &_vanished};
+  for (auto table : tables) {
+    int64_t found = table->find(pid);
+    if (found >= 0) {
+      if (table->startTime((size_t) found) != startTime) {
+        return false;
+      }
+      *last = table;
+      *row = (size_t) found;
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * account the ticks of processes exited since the last tick, so the cpu
+ * of short-lived processes is not lost
+ */
+void TopSampler::collectExited(SystemTopInfo &top,
+                               yoda::ProcessTable &table) {
+  uint32_t dropped = 0;
+  _connector->drainExits(_exits, &dropped);
+  if (dropped > 0) {
+    LOG_WARN("proc connector dropped %u exit records", dropped);
+  }
+  ProcessTopInfo process;
+  for (auto &record : _exits) {
+    if (!this->parseProcessTop(this->shardOf(record.pid), record.pid,
+                               record.stat, process)) {
+      continue;
+    }
+    process.sampleTime = _lastSampleTime;
+    // a leader with live threads is still sampled
+    int64_t row = table.find(process.pid);
+    if (row >= 0 && table.startTime((size_t) row) == process.startTime) {
+      continue;
+    }
+    const yoda::ProcessTable *last;
+    size_t lastRow;
+    process.state[0] = 'X';
+    process.ticksDelta = process.ticks;
+    if (this->findLast(process.pid, process.startTime, &last, &lastRow)) {
+      process.ticksDelta -= last->ticks(lastRow);
+    }
+    _cpuTotalJif->processTickTotal += process.ticksDelta;
+    // the pid may already belong to a new process, keep the live one
+    if (row < 0) {
+      table.insert(process);
+    }
+    ++top.exited;
+  }
+}
+
+/*
+ * fault rates of every process, context switch rates of the processes on
+ * cpu in the tick, whose status is read
+ */
+void TopSampler::updateRates(ScanShard &shard, ProcessTopInfo &process,
+                             const yoda::ProcessTable &last, size_t lastRow) {
+  // more than one tick if the last sample was carried forward
+  float seconds = (process.sampleTime - last.sampleTime(lastRow)) / 1e9f;
+  if (_tickSeconds <= 0 || seconds <= 0) {
+    return;
+  }
+  process.minFltRate = (process.minFlt - last.minFlt(lastRow)) / seconds;
+  process.majFltRate = (process.majFlt - last.majFlt(lastRow)) / seconds;
+  if (process.ticksDelta == 0 ||
+      !this->readSwitches(shard, process.pid, process)) {
+    return;
+  }
+  // the counters of a process off cpu in the last tick were not read
+  if (last.hasSwitches(lastRow)) {
+    process.nvcswRate = (process.nvcsw - last.nvcsw(lastRow)) / seconds;
+    process.nivcswRate = (process.nivcsw - last.nivcsw(lastRow)) / seconds;
+  }
+}
+
+/*
+ * sample the pids of shard into table, from the pid the last tick stopped
+ * at. Pids left at the deadline keep their last sample
+ */
+void TopSampler::scanShard(ScanShard &shard, yoda::ProcessTable &table) {
+  shard.gone.clear();
+  shard.tickTotal = 0;
+  shard.skipped = 0;
+  ProcessTopInfo process;
+  size_t count = shard.pids.size();
+  size_t start = 0;
+  if (_scanDeadline != 0) {
+    // the pids come in dir or connector order, which changes across ticks
+    std::sort(shard.pids.begin(), shard.pids.end());
+    start = std::lower_bound(shard.pids.begin(), shard.pids.end(),
+                             shard.resumePid) - shard.pids.begin();
+    if (start == count) {
+      start = 0;
+    }
+  }
+  bool expired = false;
+  for (size_t n = 0; n < count; ++n) {
+    size_t i = start + n < count ? start + n : start + n - count;
+    uint32_t pid = shard.pids[i];
+    // one pid at least, a shard which got no cpu before the deadline
+    // would start at the same pid forever
+    if (!expired && n > 0 && _scanDeadline != 0 &&
+        uv_hrtime() >= _scanDeadline) {
+      expired = true;
+      shard.resumePid = pid;
+    }
+    if (expired) {
+      ++shard.skipped;
+      this->carryForward(shard, pid, table);
+      continue;
+    }
+    if (!this->readProcessTop(shard, pid, process)) {
+      shard.gone.push_back(pid);
+      continue;
+    }
+    process.sampleTime = _lastSampleTime;
+    if (_schedStat) {
+      this->readSchedStat(shard, pid, process);
+    }
+    const yoda::ProcessTable *last;
+    size_t lastRow;
+    if (this->findLast(process.pid, process.startTime, &last, &lastRow)) {
+      uint64_t lastTime = last->sampleTime(lastRow);
+      process.ticksDelta = this->tickShare(
+        process.ticks - last->ticks(lastRow), lastTime);
+      shard.tickTotal += process.ticksDelta;
+      this->updateRates(shard, process, *last, lastRow);
+      if (process.hasSchedStat && last->hasSchedStat(lastRow)) {
+        process.runDelta = this->tickShare(
+          process.runTime - last->runTime(lastRow), lastTime);
+        process.waitDelta = this->tickShare(
+          process.waitTime - last->waitTime(lastRow), lastTime);
+        process.timeslicesDelta = this->tickShare(
+          process.timeslices - last->timeslices(lastRow), lastTime);
+      }
+    }
+    table.insert(process);
+  }
+}
+
+/*
+ * copy the row of the last tick of a pid skipped in this tick, so it stays
+ * in the snapshot and keeps its baseline, cached fds and identity
+ */
+void TopSampler::carryForward(ScanShard &shard, uint32_t pid,
+                              yoda::ProcessTable &table) {
+  int64_t row = _last->find(pid);
+  if (row < 0) {
+    return;
+  }
+  ProcessTopInfo process;
+  _last->get((size_t) row, process);
+  // nothing was measured in this tick, the next sample has the delta
+  process.ticksDelta = 0;
+  process.cpuUsagePercent = 0;
+  process.minFltRate = 0;
+  process.majFltRate = 0;
+  process.nvcswRate = 0;
+  process.nivcswRate = 0;
+  process.runDelta = 0;
+  process.waitDelta = 0;
+  process.timeslicesDelta = 0;
+  table.insert(process);
+  shard.fdCache->keep(pid);
+  shard.identityCache.keep(pid);
+}
+
+/*
+ * the part of a delta since lastTime which falls into this tick. The
+ * baseline of a pid skipped last tick is older than the last tick, its
+ * whole delta would count twice against the busy ticks of one tick
+ */
+uint64_t TopSampler::tickShare(uint64_t delta, uint64_t lastTime) const {
+  if (lastTime == 0 || lastTime >= _prevSampleTime) {
+    return delta;
+  }
+  return (uint64_t) ((double) delta * (_lastSampleTime - _prevSampleTime) /
+                     (_lastSampleTime - lastTime));
+}
+
+std::shared_ptr<SystemTopInfo> TopSampler::sample(const std::string &dir) {
   std::shared_ptr<SystemTopInfo> top(new SystemTopInfo);
-  top->cpu = getCPUTop(dir);
-  cpuTotalJif->processTickTotal = 0;
-
-  std::vector<std::string> files(yoda::Util::getFileList(dir));
-  bool isFirstTime = processesJif.empty();
-  for (auto &file : files) {
-    uint32_t pid;
-    // determine if file is pid dir
-    if (yoda::Util::lexicalCast<uint32_t>(file, &pid)) {
-      std::string pidDir(dir);
-      pidDir += "/" + file;
-      if (yoda::Util::isDir(pidDir)) {
-        std::shared_ptr<ProcessTopInfo> process(getProcessTop(pidDir, pid));
-        if (!process) {
-          continue;
-        }
-        top->processes.insert({process->pid, process});
-        auto ite = processesJif.find(process->pid);
-        if (ite != processesJif.end()) {
-          process->ticksDelta = process->ticks - ite->second->ticks;
-          cpuTotalJif->processTickTotal += process->ticksDelta;
-          ite->second = process;
-        } else {
-          processesJif.insert({process->pid, process});
-        }
+  top->cpu = this->sampleCPU(dir);
+  _cpuTotalJif->processTickTotal = 0;
+  this->initScanShards(dir);
+  uint64_t now = uv_hrtime();
+  _tickSeconds = _lastSampleTime ? (now - _lastSampleTime) / 1e9f : 0.0f;
+  _prevSampleTime = _lastSampleTime;
+  _lastSampleTime = now;
+  top->tickMs = _tickSeconds * 1000.0f;
+
+  bool isFirstTime = _last->size() == 0;
+  // recycle the table published before last unless a reader still holds it
+  std::shared_ptr<yoda::ProcessTable> next;
+  if (_spare && _spare.use_count() == 1) {
+    next.swap(_spare);
+    next->clear();
+  } else {
+    _spare.reset();
+    next.reset(new yoda::ProcessTable);
+  }
+  auto &table = *next;
+  top->fullScan = this->collectPids(dir);
+  for (auto &shard : _shards) {
+    shard->pids.clear();
+  }
+  for (auto pid : _pids) {
+    this->shardOf(pid).pids.push_back(pid);
+  }
+  _scanDeadline = 0;
+  if (_scanWindowMs > 0) {
+    _scanDeadline = uv_hrtime() + _scanWindowMs * (uint64_t) 1000000;
+  }
+  // a single shard samples straight into the table
+  _scanTable = _shards.size() == 1 ? &table : nullptr;
+  _workers.run([this](size_t i) {
+    auto &shard = *_shards[i];
+    if (_scanTable) {
+      this->scanShard(shard, *_scanTable);
+    } else {
+      shard.processes.clear();
+      this->scanShard(shard, shard.processes);
+    }
+  });
+  ProcessTopInfo process;
+  for (auto &shard : _shards) {
+    _cpuTotalJif->processTickTotal += shard->tickTotal;
+    top->skipped += shard->skipped;
+    if (_connector) {
+      for (auto pid : shard->gone) {
+        _connector->remove(pid);
+      }
+    }
+    if (!_scanTable) {
+      for (size_t row = 0; row < shard->processes.size(); ++row) {
+        shard->processes.get(row, process);
+        table.insert(process);
       }
     }
   }
+  if (_connector) {
+    this->collectExited(*top, table);
+  }
   /* This happens if there were lots of short-lived processes
   * between two top updates (e.g. compilation) */
-  if (cpuTotalJif->processTickTotal < cpuTotalJif->busyDelta) {
-    cpuTotalJif->processTickTotal = cpuTotalJif->busyDelta;
+  if (_cpuTotalJif->processTickTotal < _cpuTotalJif->busyDelta) {
+    _cpuTotalJif->processTickTotal = _cpuTotalJif->busyDelta;
   }
   if (!isFirstTime) {
-    auto cpup = float(cpuTotalJif->busyDelta) / cpuTotalJif->totalDelta;
-    auto &totalTick = cpuTotalJif->processTickTotal;
-    for (auto &pair : top->processes) {
-      auto &p = pair.second;
+    auto cpup = float(_cpuTotalJif->busyDelta) / _cpuTotalJif->totalDelta;
+    auto &totalTick = _cpuTotalJif->processTickTotal;
+    for (size_t row = 0; row < table.size(); ++row) {
+      auto ticksDelta = table.ticksDelta(row);
       /*
        * CPU% = s->pcpu/sum(s->pcpu) * busy_cpu_ticks/total_cpu_ticks
        * (pcpu is delta of sys+user time between samples)
       */
-      p->cpuUsagePercent = CAL_PERCENT_1000(p->ticksDelta * cpup, totalTick);
-      if (p->cpuUsagePercent >= 100) {
-        p->cpuUsagePercent = 100.0f;
+      auto cpuUsagePercent = CAL_PERCENT_1000(ticksDelta * cpup, totalTick);
+      if (cpuUsagePercent >= 100) {
+        cpuUsagePercent = 100.0f;
         LOG_ERROR("cpu usage error: %" PRIu64 " %f %" PRIu64,
-          p->ticksDelta, cpup, totalTick);
+          ticksDelta, cpup, totalTick);
+      }
+      table.setCpuUsage(row, ticksDelta, cpuUsagePercent);
+    }
+  }
+  _vanished.clear();
+  if (_connector) {
+    for (size_t row = 0; row < _last->size(); ++row) {
+      if (table.find(_last->pid(row)) < 0) {
+        _last->get(row, process);
+        _vanished.insert(process);
       }
     }
   }
-  processesJif = top->processes;
+  // the table is immutable from now on
+  std::atomic_store(&_published,
+                    std::shared_ptr<const yoda::ProcessTable>(next));
+  _spare.swap(_last);
+  _last.swap(next);
+  top->processes = _last;
+  for (auto &shard : _shards) {
+    shard->identityCache.endTick();
+    top->syscalls += shard->fdCache->endTick();
+    top->cachedFds += shard->fdCache->openFds();
+  }
 
   return top;
 }
 
-static int32_t
-readCPUJif(FILE *fp, const std::shared_ptr<SystemCPUInfo> &coreJif) {
-  static const char fmt[] = "cp%*s %" PRIu64 " %" PRIu64 " %" PRIu64 \
-      " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64;
-
-  /* not "cpu" */
-  if (!fgets(line_buf, LINE_BUF_SIZE, fp) || line_buf[0] != 'c') {
-    return -1;
-  }
-  int r = sscanf(line_buf, fmt,
-                 &coreJif->usr, &coreJif->nic, &coreJif->sys, &coreJif->idle,
-                 &coreJif->iowait, &coreJif->irq, &coreJif->softirq,
-                 &coreJif->steal);
-  if (r < 4) {
-    return -2;
-  }
+static void
+readCPUJif(const yoda::ProcStatReader::CPUJif &jif,
+           const std::shared_ptr<SystemCPUInfo> &coreJif) {
+  coreJif->usr = jif.usr;
+  coreJif->nic = jif.nic;
+  coreJif->sys = jif.sys;
+  coreJif->idle = jif.idle;
+  coreJif->iowait = jif.iowait;
+  coreJif->irq = jif.irq;
+  coreJif->softirq = jif.softirq;
+  coreJif->steal = jif.steal;
   coreJif->total = coreJif->usr + coreJif->nic + coreJif->sys +
                    coreJif->idle + coreJif->iowait + coreJif->irq +
                    coreJif->softirq + coreJif->steal;
   /* procps 2.x does not count iowait as busy time */
   coreJif->busy = coreJif->total - coreJif->idle - coreJif->iowait;
-
-  return 0;
 }
 
 #define CAL_CPU_USAGE_PERCENT(cur, prev)\
@@ -413,54 +1018,60 @@ readCPUJif(FILE *fp, const std::shared_ptr<SystemCPUInfo> &coreJif) {
   cur->sysPercent = CAL_PERCENT_1000(cur->sys - prev->sys, cur->totalDelta);\
   cur->usrPercent = CAL_PERCENT_1000(cur->usr - prev->usr, cur->totalDelta);
 
-std::shared_ptr<SystemCPUDetailInfo> getCPUTop(const std::string &dir) {
-  std::string statDir = dir + "/stat";
-  FILE *fp = fopen(statDir.c_str(), "r");
-  ASSERT(fp, "read %s failed", dir.c_str());
-  int32_t r;
+std::shared_ptr<SystemCPUDetailInfo>
+TopSampler::sampleCPU(const std::string &dir) {
+  if (!_procStat) {
+    _procStat.reset(new yoda::ProcStatReader(dir + "/stat"));
+  }
+  int32_t r = _procStat->read();
+  ASSERT(r == 0, "read %s/stat failed code %d", dir.c_str(), r);
+  auto &cores = _procStat->cores();
 
   /* We need to parse cumulative counts even if SMP CPU display is on,
    * they are used to calculate per process CPU% */
-  if (!cpuTotalJif) {
-    /* First time here. How many CPUs?
-     * There will be at least 1 /proc/stat line with cpu%d
-     */
+  if (!_cpuTotalJif) {
     LOG_INFO("reading first time");
-    cpuTotalJif = std::make_shared<SystemCPUInfo>();
-    cpuTotalPrevJif = std::make_shared<SystemCPUInfo>();
-    r = readCPUJif(fp, cpuTotalJif);
-    ASSERT(r == 0, "read total cpu failed code %d", r);
-    while (true) {
+    _cpuTotalJif = std::make_shared<SystemCPUInfo>();
+    _cpuTotalPrevJif = std::make_shared<SystemCPUInfo>();
+    readCPUJif(_procStat->total(), _cpuTotalJif);
+  } else {
+    _cpuTotalJif.swap(_cpuTotalPrevJif);
+    readCPUJif(_procStat->total(), _cpuTotalJif);
+    CAL_CPU_USAGE_PERCENT(_cpuTotalJif, _cpuTotalPrevJif);
+  }
+
+  /* Cores are kept by cpu id, hotplug takes the cpuN lines of offline
+   * cores out of /proc/stat */
+  _cpuCoresJif.swap(_cpuCoresPrevJif);
+  for (size_t i = 0; i < _cpuCoresJif.size(); ++i) {
+    auto &coreJif = _cpuCoresJif[i];
+    *coreJif = SystemCPUInfo();
+    coreJif->cpu = (uint32_t) i;
+    coreJif->online = false;
+  }
+  for (auto &core : cores) {
+    while (core.cpu >= _cpuCoresJif.size()) {
       std::shared_ptr<SystemCPUInfo> cpuCoreJif(new SystemCPUInfo);
-      r = readCPUJif(fp, cpuCoreJif);
-      if (r == 0) {
-        cpuCoresJif.emplace_back(cpuCoreJif);
-        cpuCoresPrevJif.emplace_back(std::make_shared<SystemCPUInfo>());
-      } else {
-        break;
-      }
+      cpuCoreJif->cpu = (uint32_t) _cpuCoresJif.size();
+      cpuCoreJif->online = false;
+      _cpuCoresJif.emplace_back(cpuCoreJif);
+      _cpuCoresPrevJif.emplace_back(
+        std::make_shared<SystemCPUInfo>(*cpuCoreJif));
     }
-  } else {
-    cpuTotalJif.swap(cpuTotalPrevJif);
-    r = readCPUJif(fp, cpuTotalJif);
-    ASSERT(r == 0, "read total cpu failed code %d", r);
-    CAL_CPU_USAGE_PERCENT(cpuTotalJif, cpuTotalPrevJif);
-
-    cpuCoresJif.swap(cpuCoresPrevJif);
-    /* Get the new samples */
-    for (size_t i = 0; i < cpuCoresJif.size(); ++i) {
-      auto coreJif = cpuCoresJif.at(i);
-      auto corePrevJif = cpuCoresPrevJif.at(i);
-      r = readCPUJif(fp, coreJif);
-      ASSERT(r == 0, "read cpu %zu failed code %d", i, r);
+    auto &coreJif = _cpuCoresJif[core.cpu];
+    auto &corePrevJif = _cpuCoresPrevJif[core.cpu];
+    readCPUJif(core, coreJif);
+    coreJif->online = true;
+    // a core back from offline starts over from this sample
+    if (corePrevJif->online) {
       CAL_CPU_USAGE_PERCENT(coreJif, corePrevJif);
     }
   }
-  fclose(fp);
 
   std::shared_ptr<SystemCPUDetailInfo> detail(new SystemCPUDetailInfo);
-  detail->total = cpuTotalJif;
-  detail->cores = cpuCoresJif;
+  detail->total = _cpuTotalJif;
+  detail->cores = _cpuCoresJif;
+  detail->counters = _procStat->counters();
   return detail;
 }
 
@@ -8,22 +8,197 @@
 #include "def.h"
 #include "executor_def.h"
 
+#include "pid_enumerator.h"
+#include "proc_connector.h"
+#include "proc_stat.h"
+#include "process_table.h"
+#include "scan_workers.h"
+#include "smap_files.h"
+#include "smaps_parser.h"
+
 // from https://github.com/mirror/busybox
 namespace busybox {
 
-std::shared_ptr<SystemCPUDetailInfo> getCPUTop(const std::string &dir);
+/*
+ * Samples the cpu and process tops. Every completed tick publishes its
+ * process table as an immutable snapshot, which other threads look up
+ * while the next tick is sampled.
+ *
+ * All methods but findProcess and snapshot are called from one thread
+ * at a time.
+ */
+class TopSampler {
+public:
+  TopSampler();
 
-std::shared_ptr<ProcessTopInfo> getProcessTop(const std::string &dir,
-                                              uint32_t pid);
+  ~TopSampler();
 
-std::shared_ptr<ProcessTopInfo> getProcessTopCache(uint32_t pid);
+  /*
+   * keep /proc/<pid>/stat fds open across ticks and re-read them with pread
+   */
+  void setProcFdCache(bool persistent);
 
-std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
+  /*
+   * read /proc/<pid>/schedstat of every process besides its stat
+   */
+  void setSchedStat(bool enable);
+
+  /*
+   * sample the pids with threads threads, pid % threads picks the thread.
+   * Pids not sampled within windowMs are skipped in the tick and keep their
+   * last sample, the next tick starts with the first skipped pid. 0 means
+   * no limit. It takes effect only before the first sample.
+   */
+  void setScanThreads(uint32_t threads, uint32_t windowMs);
+
+  /*
+   * take the pids to sample from the proc connector instead of listing the
+   * proc dir, which is still listed every reconcileTicks ticks.
+   * Pass nullptr to unset.
+   */
+  void setProcConnector(const std::shared_ptr<yoda::ProcConnector> &connector,
+                        uint32_t reconcileTicks);
+
+  /*
+   * dir is the proc dir, e.g. /proc
+   */
+  std::shared_ptr<SystemTopInfo> sample(const std::string &dir);
+
+  std::shared_ptr<SystemCPUDetailInfo> sampleCPU(const std::string &dir);
+
+  std::shared_ptr<ProcessTopInfo> sampleProcess(const std::string &dir,
                                                 uint32_t pid);
 
-std::shared_ptr<SystemMemoryInfo> getSystemMemory(const std::string &dir);
+  /*
+   * the process in the last published snapshot, thread safe
+   */
+  std::shared_ptr<ProcessTopInfo> findProcess(uint32_t pid) const;
+
+  /*
+   * the last published process table, thread safe
+   */
+  std::shared_ptr<const yoda::ProcessTable> snapshot() const;
+
+private:
+  struct ScanShard;
+
+  void initScanShards(const std::string &dir);
+
+  ScanShard &shardOf(uint32_t pid) {
+    return *_shards[pid % _shards.size()];
+  }
+
+  std::shared_ptr<const ProcessIdentity>
+  processIdentity(ScanShard &shard, uint32_t pid, uint64_t startTime,
+                  const char *comm, size_t commLen);
+
+  bool parseProcessTop(ScanShard &shard, uint32_t pid, char *buf,
+                       ProcessTopInfo &info);
+
+  bool readProcessTop(ScanShard &shard, uint32_t pid, ProcessTopInfo &info);
+
+  bool collectPids(const std::string &dir);
+
+  bool readSwitches(ScanShard &shard, uint32_t pid, ProcessTopInfo &info);
+
+  bool readSchedStat(ScanShard &shard, uint32_t pid, ProcessTopInfo &info);
+
+  bool findLast(uint32_t pid, uint64_t startTime,
+                const yoda::ProcessTable **last, size_t *row) const;
 
-std::shared_ptr<SystemTopInfo> getSystemTop(const std::string &dir);
+  void updateRates(ScanShard &shard, ProcessTopInfo &process,
+                   const yoda::ProcessTable &last, size_t lastRow);
+
+  void collectExited(SystemTopInfo &top, yoda::ProcessTable &table);
+
+  void scanShard(ScanShard &shard, yoda::ProcessTable &table);
+
+  void carryForward(ScanShard &shard, uint32_t pid,
+                    yoda::ProcessTable &table);
+
+  uint64_t tickShare(uint64_t delta, uint64_t lastTime) const;
+
+  // the published snapshot, only accessed with std::atomic_load/store
+  std::shared_ptr<const yoda::ProcessTable> _published;
+  // samples of the last tick, the same table as _published
+  std::shared_ptr<yoda::ProcessTable> _last;
+  // the table published before, reused once no reader holds it
+  std::shared_ptr<yoda::ProcessTable> _spare;
+  // samples of the last tick which were gone in this tick, an exit record
+  // may arrive one tick late
+  yoda::ProcessTable _vanished;
+
+  std::shared_ptr<SystemCPUInfo> _cpuTotalJif;
+  std::shared_ptr<SystemCPUInfo> _cpuTotalPrevJif;
+  std::vector<std::shared_ptr<SystemCPUInfo>> _cpuCoresJif;
+  std::vector<std::shared_ptr<SystemCPUInfo>> _cpuCoresPrevJif;
+  std::unique_ptr<yoda::ProcStatReader> _procStat;
+
+  bool _fdPersistent;
+  bool _schedStat;
+  std::vector<std::unique_ptr<ScanShard>> _shards;
+  size_t _shardCount;
+  uint32_t _scanWindowMs;
+  yoda::ScanWorkers _workers;
+  // inputs of the running scan
+  yoda::ProcessTable *_scanTable;
+  uint64_t _scanDeadline;
+  uint64_t _lastSampleTime;
+  uint64_t _prevSampleTime;
+  float _tickSeconds;
+
+  yoda::PidEnumerator _pidEnumerator;
+  std::shared_ptr<yoda::ProcConnector> _connector;
+  uint32_t _reconcileTicks;
+  uint32_t _ticksSinceScan;
+  std::vector<uint32_t> _pids;
+  std::vector<yoda::ProcConnector::ExitRecord> _exits;
+};
+
+/*
+ * the top sampler of the process
+ */
+TopSampler &topSampler();
+
+/*
+ * the totals of the mappings of /proc/<pid>/smaps read with fgets, each
+ * mapping is also added to files if there is one
+ */
+std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
+                                                uint32_t pid,
+                                                yoda::SmapFileTable *files =
+                                                nullptr);
+
+/*
+ * getProcessSmap with the chunked parser, the buffer of parser is reused
+ * across calls
+ */
+std::shared_ptr<ProcessSmapInfo> getProcessSmap(const std::string &dir,
+                                                uint32_t pid,
+                                                yoda::SmapsParser &parser,
+                                                yoda::SmapFileTable *files =
+                                                nullptr);
+
+/*
+ * the cheap signals of a smaps change: rss from statm if rss is not null,
+ * and the mapping count from maps
+ */
+bool getSmapSignals(const std::string &dir, uint64_t *rss,
+                    uint32_t *mapsLines);
+
+/*
+ * whether the kernel has /proc/<pid>/smaps_rollup
+ */
+bool hasSmapsRollup(const std::string &procDir);
+
+/*
+ * the totals of getProcessSmap from the one smaps_rollup record, without
+ * the per mapping sizes
+ */
+std::shared_ptr<ProcessSmapInfo> getProcessSmapRollup(const std::string &dir,
+                                                      uint32_t pid);
+
+std::shared_ptr<SystemMemoryInfo> getSystemMemory(const std::string &dir);
 
 }
 
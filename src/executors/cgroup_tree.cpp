@@ -0,0 +1,345 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "cgroup_tree.h"
+#include "proc_scan.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/inotify.h>
+
+#define CGROUP_BUFSIZE (4 * 1024)
+#define CGROUP_MAX_BUFSIZE (64 * 1024)
+#define INOTIFY_BUFSIZE 4096
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+static const char *cgroupFiles[] = {
+  "cpu.stat", "cpu.pressure", "memory.current", "memory.stat", "io.stat"
+};
+
+namespace {
+
+template<size_t N>
+inline bool keyIs(const char *key, const char *end, const char (&name)[N]) {
+  return (size_t) (end - key) == N - 1 && memcmp(key, name, N - 1) == 0;
+}
+
+}
+
+CgroupTree::CgroupTree(const std::string &root, uint32_t maxDepth) :
+  _root(root),
+  _maxDepth(maxDepth),
+  _inotifyFd(-1),
+  _poll(nullptr),
+  _dirty(true),
+  _removedMutex(),
+  _removedWds(),
+  _nodes(),
+  _buf(CGROUP_BUFSIZE),
+  _usages(),
+  _lastReadMs(0) {
+
+}
+
+CgroupTree::~CgroupTree() {
+  this->stop();
+  for (auto &item : _nodes) {
+    this->closeNode(item.second);
+  }
+}
+
+int32_t CgroupTree::start(uv_loop_t *loop) {
+  _inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (_inotifyFd < 0) {
+    LOG_ERROR("cgroup inotify error: %s", strerror(errno));
+    return -1;
+  }
+  _poll = new uv_poll_t;
+  uv_poll_init(loop, _poll, _inotifyFd);
+  UV_CB_WRAP3(_poll, cb, CgroupTree, onPoll, uv_poll_t, int, int);
+  uv_poll_start(_poll, UV_READABLE, cb);
+  return 0;
+}
+
+void CgroupTree::stop() {
+  if (_poll) {
+    _poll->data = nullptr;
+    uv_close((uv_handle_t *) _poll, [](uv_handle_t *handle) {
+      delete (uv_poll_t *) handle;
+    });
+    _poll = nullptr;
+  }
+  if (_inotifyFd >= 0) {
+    close(_inotifyFd);
+    _inotifyFd = -1;
+  }
+}
+
+void CgroupTree::onPoll(uv_poll_t *, int status, int) {
+  if (status < 0) {
+    LOG_ERROR("cgroup inotify poll error: %s", uv_strerror(status));
+    return;
+  }
+  char buf[INOTIFY_BUFSIZE]
+    __attribute__((aligned(__alignof__(inotify_event))));
+  bool changed = false;
+  ssize_t size;
+  while ((size = ::read(_inotifyFd, buf, sizeof(buf))) > 0) {
+    changed = true;
+    for (char *p = buf; p < buf + size;) {
+      auto *event = (inotify_event *) p;
+      p += sizeof(inotify_event) + event->len;
+      if (event->mask & (IN_DELETE_SELF | IN_IGNORED)) {
+        std::lock_guard<std::mutex> lock(_removedMutex);
+        _removedWds.push_back(event->wd);
+      }
+    }
+  }
+  // which cgroup was created does not matter, the walk finds it
+  if (changed) {
+    _dirty = true;
+  }
+}
+
+void CgroupTree::closeNode(Node &node) {
+  for (auto &fd : node.fds) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    fd = -1;
+  }
+  node.hasLast = false;
+}
+
+/*
+ * the fds of a removed directory would read the old cgroup even after a
+ * new one is created at the same path
+ */
+void CgroupTree::dropRemoved() {
+  std::vector<int> wds;
+  {
+    std::lock_guard<std::mutex> lock(_removedMutex);
+    wds.swap(_removedWds);
+  }
+  for (auto wd : wds) {
+    for (auto &item : _nodes) {
+      if (item.second.wd == wd) {
+        this->closeNode(item.second);
+        item.second.wd = -1;
+        break;
+      }
+    }
+  }
+}
+
+void CgroupTree::walk(const std::string &path, uint32_t depth) {
+  std::string dir = path.empty() ? _root : _root + "/" + path;
+  auto ite = _nodes.find(path);
+  if (ite == _nodes.end()) {
+    Node node = {};
+    node.path = "/" + path;
+    for (int i = 0; i < FILE_COUNT; ++i) {
+      node.files[i] = dir + "/" + cgroupFiles[i];
+      node.fds[i] = -1;
+    }
+    node.wd = -1;
+    ite = _nodes.insert({path, node}).first;
+  }
+  auto &node = ite->second;
+  node.seen = true;
+  if (_inotifyFd >= 0) {
+    // a watch on the same inode is only updated, another wd is another
+    // directory created at the same path
+    int wd = inotify_add_watch(_inotifyFd, dir.c_str(),
+                               IN_CREATE | IN_DELETE | IN_DELETE_SELF |
+                               IN_ONLYDIR);
+    if (wd != node.wd && node.wd >= 0) {
+      this->closeNode(node);
+    }
+    node.wd = wd;
+    inotify_add_watch(_inotifyFd, (dir + "/cgroup.events").c_str(),
+                      IN_MODIFY);
+  }
+  if (depth >= _maxDepth) {
+    return;
+  }
+  DIR *d = opendir(dir.c_str());
+  if (!d) {
+    return;
+  }
+  dirent *ent;
+  while ((ent = readdir(d))) {
+    if (ent->d_type != DT_DIR || ent->d_name[0] == '.') {
+      continue;
+    }
+    this->walk(path.empty() ? ent->d_name : path + "/" + ent->d_name,
+               depth + 1);
+  }
+  closedir(d);
+}
+
+ssize_t CgroupTree::readFile(Node &node, int file) {
+  int &fd = node.fds[file];
+  if (fd == -2) {
+    return -1;
+  }
+  ssize_t size = procscan::readFile(node.files[file], fd, _buf,
+                                    CGROUP_MAX_BUFSIZE);
+  if (size < 0 && fd < 0) {
+    fd = -2;
+  }
+  return size;
+}
+
+/*
+ * fill _usages[count], the rows of _usages are reused across reads so their
+ * path strings keep their buffers
+ */
+void CgroupTree::readNode(Node &node, float ms, size_t &count) {
+  Counters counters = {};
+  if (count == _usages.size()) {
+    _usages.emplace_back();
+  }
+  auto &usage = _usages[count];
+  std::string path;
+  path.swap(usage.path);
+  usage = CgroupUsage();
+  usage.path.swap(path);
+  usage.path.assign(node.path);
+
+  ssize_t size = this->readFile(node, CPU_STAT);
+  for (const char *p = _buf.data(), *end = p + std::max<ssize_t>(size, 0);
+       p < end;) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    const char *sep = (const char *) memchr(line, ' ', eol - line);
+    if (!sep) {
+      continue;
+    }
+    if (keyIs(line, sep, "usage_usec")) {
+      scanU64(sep, eol, &counters.usageUsec);
+    } else if (keyIs(line, sep, "throttled_usec")) {
+      scanU64(sep, eol, &counters.throttledUsec);
+    }
+  }
+
+  size = this->readFile(node, CPU_PRESSURE);
+  if (size > 0) {
+    _buf[std::min<size_t>(size, _buf.size() - 1)] = '\0';
+    sscanf(_buf.data(), "some avg10=%f", &usage.cpuSomeAvg10);
+  }
+
+  size = this->readFile(node, MEMORY_CURRENT);
+  if (size > 0) {
+    const char *cp = _buf.data();
+    scanU64(cp, cp + size, &usage.memoryCurrent);
+  }
+
+  size = this->readFile(node, MEMORY_STAT);
+  for (const char *p = _buf.data(), *end = p + std::max<ssize_t>(size, 0);
+       p < end;) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    const char *sep = (const char *) memchr(line, ' ', eol - line);
+    if (!sep) {
+      continue;
+    }
+    if (keyIs(line, sep, "anon")) {
+      scanU64(sep, eol, &usage.memoryAnon);
+    } else if (keyIs(line, sep, "file")) {
+      scanU64(sep, eol, &usage.memoryFile);
+    } else if (keyIs(line, sep, "pgmajfault")) {
+      scanU64(sep, eol, &counters.pgmajfault);
+    }
+  }
+
+  // 8:0 rbytes=90112 wbytes=0 rios=3 wios=0 dbytes=0 dios=0
+  size = this->readFile(node, IO_STAT);
+  for (const char *p = _buf.data(), *end = p + std::max<ssize_t>(size, 0);
+       p < end;) {
+    const char *eol = nextLine(p, end);
+    const char *cp = (const char *) memchr(p, ' ', eol - p);
+    p = eol;
+    while (cp && cp < eol) {
+      const char *key = skipSpaces(cp, eol);
+      const char *eq = (const char *) memchr(key, '=', eol - key);
+      if (!eq) {
+        break;
+      }
+      cp = eq + 1;
+      uint64_t value = 0;
+      scanU64(cp, eol, &value);
+      if (keyIs(key, eq, "rbytes")) {
+        counters.readBytes += value;
+      } else if (keyIs(key, eq, "wbytes")) {
+        counters.writeBytes += value;
+      } else if (keyIs(key, eq, "rios")) {
+        counters.readOps += value;
+      } else if (keyIs(key, eq, "wios")) {
+        counters.writeOps += value;
+      }
+    }
+  }
+
+  if (node.hasLast && ms > 0) {
+    auto &last = node.last;
+    auto delta = [](uint64_t now, uint64_t before) {
+      return now >= before ? now - before : 0;
+    };
+    float perSecond = 1000.0f / ms;
+    // usec of cpu per ms of wall time, 1000 is a busy core
+    usage.cpuUsage = delta(counters.usageUsec, last.usageUsec) / ms / 10.0f;
+    usage.throttledMs =
+      delta(counters.throttledUsec, last.throttledUsec) / 1000.0f;
+    usage.pgmajfaultRate =
+      delta(counters.pgmajfault, last.pgmajfault) * perSecond;
+    usage.ioReadBytes = delta(counters.readBytes, last.readBytes) * perSecond;
+    usage.ioWriteBytes =
+      delta(counters.writeBytes, last.writeBytes) * perSecond;
+    usage.ioReadOps = delta(counters.readOps, last.readOps) * perSecond;
+    usage.ioWriteOps = delta(counters.writeOps, last.writeOps) * perSecond;
+    ++count;
+  }
+  // the first read of a cgroup has no rates, its row is filled again
+  node.last = counters;
+  node.hasLast = true;
+}
+
+int32_t CgroupTree::read() {
+  this->dropRemoved();
+  if (_dirty.exchange(false) || _inotifyFd < 0) {
+    for (auto &item : _nodes) {
+      item.second.seen = false;
+    }
+    this->walk("", 0);
+    for (auto ite = _nodes.begin(); ite != _nodes.end();) {
+      if (ite->second.seen) {
+        ++ite;
+        continue;
+      }
+      this->closeNode(ite->second);
+      ite = _nodes.erase(ite);
+    }
+  }
+  if (_nodes.empty()) {
+    return -1;
+  }
+
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  float ms = _lastReadMs != 0 && nowMs > _lastReadMs ?
+             (float) (nowMs - _lastReadMs) : 0.0f;
+  size_t count = 0;
+  for (auto &item : _nodes) {
+    this->readNode(item.second, ms, count);
+  }
+  _usages.resize(count);
+  _lastReadMs = nowMs;
+  return 0;
+}
+
+YODA_NS_END
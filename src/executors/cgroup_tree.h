@@ -0,0 +1,126 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_CGROUP_TREE_H
+#define YODA_SIXSIX_CGROUP_TREE_H
+
+#include "def.h"
+#include <atomic>
+#include <mutex>
+
+YODA_NS_BEGIN
+
+/*
+ * Usage of one cgroup between two reads.
+ */
+struct CgroupUsage {
+  std::string path;
+  float cpuUsage;
+  float throttledMs;
+  float cpuSomeAvg10;
+  uint64_t memoryCurrent;
+  uint64_t memoryAnon;
+  uint64_t memoryFile;
+  float pgmajfaultRate;
+  float ioReadBytes;
+  float ioWriteBytes;
+  float ioReadOps;
+  float ioWriteOps;
+};
+
+/*
+ * A cgroup v2 subtree down to maxDepth levels below root. The files of every
+ * cgroup are kept open and re-read with pread. The tree is only walked again
+ * after inotify reported a cgroup created or removed, or a change of a
+ * cgroup.events, or on every read if inotify is not available. The files of
+ * a removed cgroup are closed, a cgroup created again at the same path is
+ * opened anew.
+ */
+class CgroupTree {
+public:
+  CgroupTree(const std::string &root, uint32_t maxDepth);
+
+  ~CgroupTree();
+
+  /*
+   * watch the tree with inotify on loop, returns 0 on success
+   */
+  int32_t start(uv_loop_t *loop);
+
+  void stop();
+
+  /*
+   * walk the tree if it changed, then read every cgroup, returns 0 on
+   * success. Called from one thread at a time, not the loop
+   */
+  int32_t read();
+
+  /*
+   * cgroups of the last read ordered by path, without the new ones
+   */
+  const std::vector<CgroupUsage> &usages() const { return _usages; }
+
+private:
+  enum {
+    CPU_STAT = 0,
+    CPU_PRESSURE,
+    MEMORY_CURRENT,
+    MEMORY_STAT,
+    IO_STAT,
+    FILE_COUNT
+  };
+
+  struct Counters {
+    uint64_t usageUsec;
+    uint64_t throttledUsec;
+    uint64_t pgmajfault;
+    uint64_t readBytes;
+    uint64_t writeBytes;
+    uint64_t readOps;
+    uint64_t writeOps;
+  };
+
+  struct Node {
+    // as reported, "/" is root
+    std::string path;
+    std::string files[FILE_COUNT];
+    // -1 is not opened yet, -2 is not there, e.g. the controller is off
+    int fds[FILE_COUNT];
+    // inotify watch of the directory, -1 if none
+    int wd;
+    bool seen;
+    bool hasLast;
+    Counters last;
+  };
+
+  void walk(const std::string &path, uint32_t depth);
+
+  void closeNode(Node &node);
+
+  void dropRemoved();
+
+  ssize_t readFile(Node &node, int file);
+
+  void readNode(Node &node, float ms, size_t &count);
+
+  void onPoll(uv_poll_t *handle, int status, int events);
+
+  std::string _root;
+  uint32_t _maxDepth;
+  int _inotifyFd;
+  uv_poll_t *_poll;
+  std::atomic<bool> _dirty;
+  // watches of removed directories, from the loop to the reading thread
+  std::mutex _removedMutex;
+  std::vector<int> _removedWds;
+  // keyed by the path relative to root, "" is root
+  std::map<std::string, Node> _nodes;
+  std::vector<char> _buf;
+  std::vector<CgroupUsage> _usages;
+  uint64_t _lastReadMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_CGROUP_TREE_H
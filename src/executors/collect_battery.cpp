@@ -3,6 +3,7 @@
  */
 
 #include "collect_battery.h"
+#include "options.h"
 
 #define CHARGER_PATH "/sys/class/power_supply/bq25890-charger"
 #define BATTERY_PATH "/sys/class/power_supply/battery"
@@ -37,8 +38,10 @@ static void readFile(const char *path, char *buf, int32_t *value) {
 YODA_NS_BEGIN
 
 CollectBattery::CollectBattery() : IJobExecutor("CollectBattery"),
-                                   _workReq(nullptr) {
-
+                                   _workReq(nullptr),
+                                   _thermal(Options::get<std::string>(
+                                     "sysroot", "")) {
+  _thermal.open();
 }
 
 CollectBattery::~CollectBattery() {
@@ -76,7 +79,9 @@ void CollectBattery::doCollect(uv_work_t *req) {
 
   readFile(GET_BATTERY_FILE("/voltage_now"), buffer, &_bat_voltage);
 
-  readFile("/sys/devices/virtual/thermal/thermal_zone0/temp", buffer, &_cpu_temp);
+  _thermal.read();
+  auto &zones = _thermal.zones();
+  _cpu_temp = !zones.empty() && zones[0].valid ? zones[0].temp : 0;
 
   LOG_VERBOSE("========== CollectBattery finish  ==========");
 }
@@ -6,6 +6,7 @@
 #define YODA_SIXSIX_COLLECT_BATTERY_H
 
 #include "executor_def.h"
+#include "thermal.h"
 
 YODA_NS_BEGIN
 
@@ -26,6 +27,8 @@ protected:
   void afterCollect(uv_work_t *req, int status);
 
   uv_work_t *_workReq;
+  // cpu temperature from the first thermal zone, thermal_zone0
+  ThermalReader _thermal;
   int32_t _bat_temp;
   int32_t _cpu_temp;
   int32_t _current;
@@ -0,0 +1,104 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_cgroup.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectCgroup::CollectCgroup() : IJobExecutor("CollectCgroup"),
+                                 _available(false),
+                                 _workReq(nullptr),
+                                 _tree(),
+                                 _readResult(0) {
+  auto sysroot = Options::get<std::string>("sysroot", "");
+  auto root = Options::get<std::string>("cgroupRoot",
+                                        sysroot + "/sys/fs/cgroup");
+  auto maxDepth = Options::get<uint32_t>("cgroupMaxDepth", 2);
+  // only the root of a v2 hierarchy has cgroup.controllers
+  if (access((root + "/cgroup.controllers").c_str(), R_OK) != 0) {
+    LOG_INFO("%s is not cgroup v2, skip cgroup collect", root.c_str());
+    return;
+  }
+  _available = true;
+  _tree.reset(new CgroupTree(root, maxDepth));
+  _tree->start(uv_default_loop());
+}
+
+CollectCgroup::~CollectCgroup() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectCgroup::execute() {
+  if (!_available) {
+    this->onJobDone(0);
+    return;
+  }
+  ASSERT(!_workReq, "CollectCgroup is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectCgroup, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectCgroup, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectCgroup::doCollect(uv_work_t *) {
+  _readResult = _tree->read();
+}
+
+void CollectCgroup::afterCollect(uv_work_t *, int status) {
+  if (status == 0 && _readResult != 0) {
+    LOG_ERROR("read cgroup error: %d", _readResult);
+  } else if (status == 0) {
+    rokid::CgroupInfosPtr data(new rokid::CgroupInfos);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::CgroupInfo>> cgroups(
+      new std::vector<rokid::CgroupInfo>()
+    );
+    for (auto &usage : _tree->usages()) {
+      LOG_VERBOSE("cgroup %s: cpu %.1f%% throttled %.1fms some %.2f, "
+                  "mem %" PRIu64 " anon %" PRIu64 " file %" PRIu64
+                  " majflt %.1f/s, io r %.0fB/s w %.0fB/s",
+                  usage.path.c_str(), usage.cpuUsage, usage.throttledMs,
+                  usage.cpuSomeAvg10, usage.memoryCurrent, usage.memoryAnon,
+                  usage.memoryFile, usage.pgmajfaultRate, usage.ioReadBytes,
+                  usage.ioWriteBytes);
+      cgroups->emplace_back();
+      auto &info = cgroups->back();
+      info.setPath(usage.path.c_str());
+      info.setCpuUsage(usage.cpuUsage);
+      info.setThrottledMs(usage.throttledMs);
+      info.setCpuSomeAvg10(usage.cpuSomeAvg10);
+      info.setMemoryCurrent(usage.memoryCurrent);
+      info.setMemoryAnon(usage.memoryAnon);
+      info.setMemoryFile(usage.memoryFile);
+      info.setPgmajfaultRate(usage.pgmajfaultRate);
+      info.setIoReadBytes(usage.ioReadBytes);
+      info.setIoWriteBytes(usage.ioWriteBytes);
+      info.setIoReadOps(usage.ioReadOps);
+      info.setIoWriteOps(usage.ioWriteOps);
+    }
+    data->setCgroups(cgroups);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "cgroup data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectCgroup::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
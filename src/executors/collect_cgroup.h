@@ -0,0 +1,41 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_CGROUP_H
+#define YODA_SIXSIX_COLLECT_CGROUP_H
+
+#include "executor_def.h"
+#include "cgroup_tree.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends cpu, memory, io and cpu pressure of every cgroup of a cgroup v2
+ * subtree. Does nothing if the root is not a cgroup v2 hierarchy.
+ */
+class CollectCgroup : public IJobExecutor {
+public:
+  CollectCgroup();
+
+  ~CollectCgroup() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  bool _available;
+  uv_work_t *_workReq;
+  std::unique_ptr<CgroupTree> _tree;
+  int32_t _readResult;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_CGROUP_H
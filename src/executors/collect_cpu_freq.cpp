@@ -0,0 +1,148 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_cpu_freq.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectCpuFreq::CollectCpuFreq() : IJobExecutor("CollectCpuFreq"),
+                                   _available(false),
+                                   _workReq(nullptr),
+                                   _reader(Options::get<std::string>(
+                                     "sysroot", "")) {
+  _available = _reader.open() > 0;
+  if (!_available) {
+    LOG_INFO("no cpu found, skip cpu freq collect");
+    return;
+  }
+  // the first read is the baseline of the deltas
+  _reader.read();
+}
+
+CollectCpuFreq::~CollectCpuFreq() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectCpuFreq::execute() {
+  if (!_available) {
+    this->onJobDone(0);
+    return;
+  }
+  ASSERT(!_workReq, "CollectCpuFreq is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectCpuFreq, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectCpuFreq, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectCpuFreq::doCollect(uv_work_t *) {
+  _reader.read();
+  _reader.publish();
+}
+
+void CollectCpuFreq::afterCollect(uv_work_t *, int status) {
+  if (status == 0) {
+    rokid::CpuFreqInfosPtr data(new rokid::CpuFreqInfos);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::CpuFreqCore>> cores(
+      new std::vector<rokid::CpuFreqCore>()
+    );
+    struct Cluster {
+      std::string cpus;
+      uint64_t freqSum = 0;
+      uint32_t count = 0;
+      uint32_t maxFreq = 0;
+    };
+    std::map<int32_t, Cluster> clusters;
+    for (auto &core : _reader.cores()) {
+      if (!core.valid) {
+        continue;
+      }
+      LOG_VERBOSE("cpu%u cluster %d capacity %u: freq %u avg %u max %u",
+                  core.cpu, core.cluster, core.capacity, core.curFreq,
+                  core.avgFreq, core.maxFreq);
+      cores->emplace_back();
+      auto &info = cores->back();
+      info.setCpu(core.cpu);
+      info.setCluster(core.cluster);
+      info.setCapacity(core.capacity);
+      info.setCurFreq(core.curFreq);
+      info.setAvgFreq(core.avgFreq);
+      info.setMaxFreq(core.maxFreq);
+      std::shared_ptr<std::vector<rokid::CpuFreqResidency>> freqs(
+        new std::vector<rokid::CpuFreqResidency>()
+      );
+      for (auto &state : core.freqResidency) {
+        if (state.deltaMs <= 0) {
+          continue;
+        }
+        freqs->emplace_back();
+        freqs->back().setFreq(state.freq);
+        freqs->back().setTimeMs(state.deltaMs);
+      }
+      info.setFreqResidency(freqs);
+      std::shared_ptr<std::vector<rokid::CpuIdleResidency>> idles(
+        new std::vector<rokid::CpuIdleResidency>()
+      );
+      for (auto &state : core.idleResidency) {
+        LOG_VERBOSE("cpu%u idle %s: %.1fms, %" PRIu64 " times",
+                    core.cpu, state.name.c_str(), state.deltaMs,
+                    state.usageDelta);
+        idles->emplace_back();
+        idles->back().setName(state.name.c_str());
+        idles->back().setTimeMs(state.deltaMs);
+        idles->back().setUsage((int64_t) state.usageDelta);
+      }
+      info.setIdleResidency(idles);
+
+      auto &cluster = clusters[core.cluster];
+      if (cluster.count > 0) {
+        cluster.cpus += ",";
+      }
+      cluster.cpus += std::to_string(core.cpu);
+      cluster.freqSum += core.avgFreq;
+      cluster.maxFreq = std::max(cluster.maxFreq, core.maxFreq);
+      ++cluster.count;
+    }
+    data->setCores(cores);
+    std::shared_ptr<std::vector<rokid::CpuCluster>> clusterList(
+      new std::vector<rokid::CpuCluster>()
+    );
+    for (auto &item : clusters) {
+      auto &cluster = item.second;
+      auto avgFreq = (uint32_t) (cluster.freqSum / cluster.count);
+      LOG_VERBOSE("cluster %d cpus %s: avg %u max %u", item.first,
+                  cluster.cpus.c_str(), avgFreq, cluster.maxFreq);
+      clusterList->emplace_back();
+      auto &info = clusterList->back();
+      info.setCluster(item.first);
+      info.setCpus(cluster.cpus.c_str());
+      info.setAvgFreq(avgFreq);
+      info.setMaxFreq(cluster.maxFreq);
+    }
+    data->setClusters(clusterList);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "cpu freq data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectCpuFreq::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
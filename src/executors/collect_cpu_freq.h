@@ -0,0 +1,40 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_CPU_FREQ_H
+#define YODA_SIXSIX_COLLECT_CPU_FREQ_H
+
+#include "executor_def.h"
+#include "cpu_freq.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends the frequency, time_in_state and cpuidle residency of every cpu,
+ * with the cpus grouped by cluster.
+ */
+class CollectCpuFreq : public IJobExecutor {
+public:
+  CollectCpuFreq();
+
+  ~CollectCpuFreq() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  bool _available;
+  uv_work_t *_workReq;
+  CpuFreqReader _reader;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_CPU_FREQ_H
@@ -0,0 +1,87 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_disk_stats.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectDiskStats::CollectDiskStats() :
+  IJobExecutor("CollectDiskStats"),
+  _workReq(nullptr),
+  _reader(Options::get<std::string>("sysroot", ""),
+          Options::get<uint32_t>("diskPartitions", 0) != 0),
+  _readResult(0) {
+
+}
+
+CollectDiskStats::~CollectDiskStats() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectDiskStats::execute() {
+  ASSERT(!_workReq, "CollectDiskStats is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectDiskStats, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectDiskStats, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectDiskStats::doCollect(uv_work_t *) {
+  _readResult = _reader.read();
+}
+
+void CollectDiskStats::afterCollect(uv_work_t *, int status) {
+  if (status == 0 && _readResult != 0) {
+    LOG_ERROR("read diskstats error: %d", _readResult);
+  } else if (status == 0) {
+    rokid::DiskStatsPtr data(new rokid::DiskStats);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::DiskStat>> disks(
+      new std::vector<rokid::DiskStat>()
+    );
+    for (auto &stat : _reader.stats()) {
+      LOG_VERBOSE("disk %s: r %.1f/s %.0fB/s %.2fms, w %.1f/s %.0fB/s "
+                  "%.2fms, util %.1f%%, queue %.2f, in flight %u",
+                  stat.device.c_str(), stat.readIops, stat.readBytes,
+                  stat.readAwait, stat.writeIops, stat.writeBytes,
+                  stat.writeAwait, stat.util, stat.queueDepth,
+                  stat.inFlight);
+      disks->emplace_back();
+      auto &disk = disks->back();
+      disk.setDevice(stat.device.c_str());
+      disk.setReadIops(stat.readIops);
+      disk.setWriteIops(stat.writeIops);
+      disk.setReadBytes(stat.readBytes);
+      disk.setWriteBytes(stat.writeBytes);
+      disk.setReadAwait(stat.readAwait);
+      disk.setWriteAwait(stat.writeAwait);
+      disk.setUtil(stat.util);
+      disk.setQueueDepth(stat.queueDepth);
+      disk.setInFlight(stat.inFlight);
+    }
+    data->setDisks(disks);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "disk stats");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectDiskStats::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
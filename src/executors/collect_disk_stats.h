@@ -0,0 +1,40 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_DISK_STATS_H
+#define YODA_SIXSIX_COLLECT_DISK_STATS_H
+
+#include "executor_def.h"
+#include "disk_stats.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends iops, throughput, await, utilization and queue depth of the block
+ * devices with io, whole disks only unless diskPartitions is set.
+ */
+class CollectDiskStats : public IJobExecutor {
+public:
+  CollectDiskStats();
+
+  ~CollectDiskStats() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  uv_work_t *_workReq;
+  DiskStatsReader _reader;
+  int32_t _readResult;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_DISK_STATS_H
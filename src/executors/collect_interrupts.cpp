@@ -0,0 +1,123 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_interrupts.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectInterrupts::CollectInterrupts() :
+  IJobExecutor("CollectInterrupts"),
+  _workReq(nullptr),
+  _interrupts(Options::get<std::string>("sysroot", "") + "/proc/interrupts"),
+  _softirqs(Options::get<std::string>("sysroot", "") + "/proc/softirqs"),
+  _topCount(Options::get<uint32_t>("irqTopCount", 10)),
+  _readResult(0),
+  _irqRows(),
+  _softirqRows(),
+  _irqTotal(0) {
+  // the first read is the baseline of the deltas
+  _interrupts.read();
+  _softirqs.read();
+}
+
+CollectInterrupts::~CollectInterrupts() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectInterrupts::execute() {
+  ASSERT(!_workReq, "CollectInterrupts is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectInterrupts, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectInterrupts, afterCollect, uv_work_t,
+              int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectInterrupts::doCollect(uv_work_t *) {
+  _readResult = _interrupts.read();
+  _irqTotal = 0;
+  if (_readResult == 0) {
+    for (size_t row = 0; row < _interrupts.rows(); ++row) {
+      _irqTotal += _interrupts.totalDelta(row);
+    }
+    _interrupts.top(_topCount, _irqRows);
+  }
+  if (_softirqs.read() == 0) {
+    // about ten of them, all are sent
+    _softirqs.top(_softirqs.rows(), _softirqRows);
+  } else {
+    _softirqRows.clear();
+  }
+}
+
+std::shared_ptr<std::vector<rokid::IrqInfo>> CollectInterrupts::makeInfos(
+  const InterruptReader &reader, const std::vector<size_t> &rows,
+  const char *kind) {
+  std::shared_ptr<std::vector<rokid::IrqInfo>> infos(
+    new std::vector<rokid::IrqInfo>()
+  );
+  float perSecond = reader.intervalMs() > 0 ? 1000.0f / reader.intervalMs()
+                                            : 0.0f;
+  auto &cpus = reader.cpus();
+  for (auto row : rows) {
+    float rate = reader.totalDelta(row) * perSecond;
+    LOG_VERBOSE("%s %s: %.1f/s %s", kind, reader.name(row).c_str(), rate,
+                reader.desc(row).c_str());
+    infos->emplace_back();
+    auto &info = infos->back();
+    info.setName(reader.name(row).c_str());
+    info.setDesc(reader.desc(row).c_str());
+    info.setRate(rate);
+    std::shared_ptr<std::vector<rokid::IrqCpuRate>> cpuRates(
+      new std::vector<rokid::IrqCpuRate>()
+    );
+    for (size_t column = 0; column < cpus.size(); ++column) {
+      uint64_t delta = reader.delta(row, column);
+      if (delta == 0) {
+        continue;
+      }
+      cpuRates->emplace_back();
+      cpuRates->back().setCpu(cpus[column]);
+      cpuRates->back().setRate(delta * perSecond);
+    }
+    info.setCpus(cpuRates);
+  }
+  return infos;
+}
+
+void CollectInterrupts::afterCollect(uv_work_t *, int status) {
+  if (status == 0 && _readResult != 0) {
+    LOG_ERROR("read interrupts error: %d", _readResult);
+  } else if (status == 0 && _interrupts.intervalMs() > 0) {
+    rokid::IrqInfosPtr data(new rokid::IrqInfos);
+    data->setTimestamp(time(nullptr));
+    float irqRate = _irqTotal * 1000.0f / _interrupts.intervalMs();
+    LOG_VERBOSE("interrupts %.1f/s", irqRate);
+    data->setIrqRate(irqRate);
+    data->setIrqs(this->makeInfos(_interrupts, _irqRows, "irq"));
+    data->setSoftirqs(this->makeInfos(_softirqs, _softirqRows, "softirq"));
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "irq data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectInterrupts::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
@@ -0,0 +1,49 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_INTERRUPTS_H
+#define YODA_SIXSIX_COLLECT_INTERRUPTS_H
+
+#include "executor_def.h"
+#include "interrupts.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends per cpu rates of the busiest interrupts and of the softirqs, for
+ * sys time that no process accounts for.
+ */
+class CollectInterrupts : public IJobExecutor {
+public:
+  CollectInterrupts();
+
+  ~CollectInterrupts() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  std::shared_ptr<std::vector<rokid::IrqInfo>> makeInfos(
+    const InterruptReader &reader, const std::vector<size_t> &rows,
+    const char *kind);
+
+  uv_work_t *_workReq;
+  InterruptReader _interrupts;
+  InterruptReader _softirqs;
+  size_t _topCount;
+  int32_t _readResult;
+  std::vector<size_t> _irqRows;
+  std::vector<size_t> _softirqRows;
+  uint64_t _irqTotal;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_INTERRUPTS_H
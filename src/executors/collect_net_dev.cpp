@@ -0,0 +1,84 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_net_dev.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectNetDev::CollectNetDev() : IJobExecutor("CollectNetDev"),
+                                 _workReq(nullptr),
+                                 _reader(Options::get<std::string>("sysroot",
+                                                                   "")),
+                                 _readResult(0) {
+
+}
+
+CollectNetDev::~CollectNetDev() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectNetDev::execute() {
+  ASSERT(!_workReq, "CollectNetDev is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectNetDev, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectNetDev, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectNetDev::doCollect(uv_work_t *) {
+  _readResult = _reader.read();
+}
+
+void CollectNetDev::afterCollect(uv_work_t *, int status) {
+  if (status == 0 && _readResult != 0) {
+    LOG_ERROR("read net dev error: %d", _readResult);
+  } else if (status == 0) {
+    rokid::NetDevStatsPtr data(new rokid::NetDevStats);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::NetDevStat>> interfaces(
+      new std::vector<rokid::NetDevStat>()
+    );
+    for (auto &rate : _reader.rates()) {
+      LOG_VERBOSE("net %s: rx %.0fB/s %.1fp/s err %.1f drop %.1f, "
+                  "tx %.0fB/s %.1fp/s err %.1f drop %.1f",
+                  rate.interface.c_str(), rate.rxBytes, rate.rxPackets,
+                  rate.rxErrors, rate.rxDrops, rate.txBytes, rate.txPackets,
+                  rate.txErrors, rate.txDrops);
+      interfaces->emplace_back();
+      auto &info = interfaces->back();
+      info.setInterface(rate.interface.c_str());
+      info.setRxBytes(rate.rxBytes);
+      info.setRxPackets(rate.rxPackets);
+      info.setRxErrors(rate.rxErrors);
+      info.setRxDrops(rate.rxDrops);
+      info.setTxBytes(rate.txBytes);
+      info.setTxPackets(rate.txPackets);
+      info.setTxErrors(rate.txErrors);
+      info.setTxDrops(rate.txDrops);
+    }
+    data->setInterfaces(interfaces);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "net dev stats");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectNetDev::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
@@ -0,0 +1,40 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_NET_DEV_H
+#define YODA_SIXSIX_COLLECT_NET_DEV_H
+
+#include "executor_def.h"
+#include "net_dev.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends rx/tx bytes, packets, errors and drops per second of the network
+ * interfaces with traffic.
+ */
+class CollectNetDev : public IJobExecutor {
+public:
+  CollectNetDev();
+
+  ~CollectNetDev() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  uv_work_t *_workReq;
+  NetDevReader _reader;
+  int32_t _readResult;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_NET_DEV_H
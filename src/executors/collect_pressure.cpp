@@ -0,0 +1,310 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_pressure.h"
+#include "options.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+
+#define PRESSURE_BUFSIZE 256
+
+static const char *resourceNames[] = {"cpu", "memory", "io"};
+
+/*
+ * some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ * full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ */
+static bool readPressure(const std::string &path, yoda::PressureStat &stat) {
+  char buf[PRESSURE_BUFSIZE];
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  ssize_t size = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if (size <= 0) {
+    return false;
+  }
+  buf[size] = '\0';
+  float avg300;
+  int r = sscanf(buf, "some avg10=%f avg60=%f avg300=%f total=%" SCNu64,
+                 &stat.someAvg10, &stat.someAvg60, &avg300, &stat.someTotal);
+  if (r != 4) {
+    return false;
+  }
+  // cpu has no full line before linux 5.13
+  const char *full = strstr(buf, "full ");
+  if (!full || sscanf(full, "full avg10=%f avg60=%f avg300=%f total=%" SCNu64,
+                      &stat.fullAvg10, &stat.fullAvg60, &avg300,
+                      &stat.fullTotal) != 4) {
+    stat.fullAvg10 = stat.fullAvg60 = 0.0f;
+    stat.fullTotal = 0;
+  }
+  stat.valid = true;
+  return true;
+}
+
+YODA_NS_BEGIN
+
+CollectPressure::CollectPressure() : IJobExecutor("CollectPressure"),
+                                     _available(false),
+                                     _workReq(nullptr),
+                                     _triggerStall(0),
+                                     _triggerWindow(0),
+                                     _notifyFd(-1),
+                                     _stopFd(-1),
+                                     _fired(0),
+                                     _failed(0),
+                                     _watcher(),
+                                     _poll(nullptr) {
+  auto sysroot = Options::get<std::string>("sysroot", "");
+  _pressureDir = sysroot + "/proc/pressure/";
+  for (auto &fd : _triggerFds) {
+    fd = -1;
+  }
+  for (uint32_t i = 0; i < (uint32_t) PressureResource::COUNT; ++i) {
+    if (readPressure(_pressureDir + resourceNames[i], _lastStats[i])) {
+      _available = true;
+    }
+  }
+  if (!_available) {
+    LOG_INFO("psi is not available, skip pressure collect");
+    return;
+  }
+  auto stallUs = Options::get<uint64_t>("pressureTriggerStall", 100 * 1000);
+  auto windowUs = Options::get<uint64_t>("pressureTriggerWindow",
+                                         2 * 1000 * 1000);
+  if (stallUs > 0) {
+    this->startTriggers(stallUs, windowUs);
+  }
+}
+
+CollectPressure::~CollectPressure() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+  this->stopTriggers();
+}
+
+void CollectPressure::startTriggers(uint64_t stallUs, uint64_t windowUs) {
+  char trigger[64];
+  int len = snprintf(trigger, sizeof(trigger), "some %" PRIu64 " %" PRIu64,
+                     stallUs, windowUs);
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < (uint32_t) PressureResource::COUNT; ++i) {
+    std::string path = _pressureDir + resourceNames[i];
+    int fd = open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+      continue;
+    }
+    // the trigger lives as long as the fd
+    if (write(fd, trigger, (size_t) len + 1) < 0) {
+      LOG_WARN("psi trigger %s on %s error: %s",
+               trigger, path.c_str(), strerror(errno));
+      close(fd);
+      continue;
+    }
+    _triggerFds[i] = fd;
+    ++count;
+  }
+  if (count == 0) {
+    return;
+  }
+  _notifyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  _stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (_notifyFd < 0 || _stopFd < 0) {
+    LOG_ERROR("psi eventfd error: %s", strerror(errno));
+    this->stopTriggers();
+    return;
+  }
+  _triggerStall = stallUs;
+  _triggerWindow = windowUs;
+  _poll = new uv_poll_t;
+  uv_poll_init(uv_default_loop(), _poll, _notifyFd);
+  UV_CB_WRAP3(_poll, cb, CollectPressure, onTrigger, uv_poll_t, int, int);
+  uv_poll_start(_poll, UV_READABLE, cb);
+  _watcher = std::thread(&CollectPressure::watchTriggers, this);
+  LOG_INFO("psi triggers started: %s", trigger);
+}
+
+void CollectPressure::stopTriggers() {
+  if (_watcher.joinable()) {
+    uint64_t one = 1;
+    write(_stopFd, &one, sizeof(one));
+    _watcher.join();
+  }
+  if (_poll) {
+    _poll->data = nullptr;
+    uv_close((uv_handle_t *) _poll, [](uv_handle_t *handle) {
+      delete (uv_poll_t *) handle;
+    });
+    _poll = nullptr;
+  }
+  for (auto &fd : _triggerFds) {
+    if (fd >= 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if (_notifyFd >= 0) {
+    close(_notifyFd);
+    _notifyFd = -1;
+  }
+  if (_stopFd >= 0) {
+    close(_stopFd);
+    _stopFd = -1;
+  }
+}
+
+/*
+ * runs on the watcher thread, the last pollfd is the stop eventfd
+ */
+void CollectPressure::watchTriggers() {
+  const uint32_t count = (uint32_t) PressureResource::COUNT;
+  pollfd fds[count + 1];
+  for (uint32_t i = 0; i < count; ++i) {
+    fds[i].fd = _triggerFds[i];
+    fds[i].events = POLLPRI;
+  }
+  fds[count].fd = _stopFd;
+  fds[count].events = POLLIN;
+  while (true) {
+    int r = poll(fds, count + 1, -1);
+    if (r < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG_ERROR("psi poll error: %s", strerror(errno));
+      return;
+    }
+    if (fds[count].revents) {
+      return;
+    }
+    uint32_t fired = 0;
+    uint32_t failed = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+      if (fds[i].revents & POLLERR) {
+        // a negative fd is ignored by poll
+        fds[i].fd = -1;
+        failed |= 1u << i;
+      } else if (fds[i].revents & POLLPRI) {
+        fired |= 1u << i;
+      }
+    }
+    if (fired || failed) {
+      _fired.fetch_or(fired);
+      _failed.fetch_or(failed);
+      uint64_t one = 1;
+      write(_notifyFd, &one, sizeof(one));
+    }
+  }
+}
+
+void CollectPressure::onTrigger(uv_poll_t *, int status, int) {
+  if (status < 0) {
+    LOG_ERROR("psi poll error: %s", uv_strerror(status));
+    return;
+  }
+  uint64_t value;
+  read(_notifyFd, &value, sizeof(value));
+  uint32_t fired = _fired.exchange(0);
+  uint32_t failed = _failed.exchange(0);
+  for (uint32_t i = 0; i < (uint32_t) PressureResource::COUNT; ++i) {
+    if (failed & (1u << i)) {
+      LOG_ERROR("psi trigger %s is gone", resourceNames[i]);
+      continue;
+    }
+    if (!(fired & (1u << i))) {
+      continue;
+    }
+    PressureStat stat;
+    readPressure(_pressureDir + resourceNames[i], stat);
+    LOG_INFO("psi trigger %s: some avg10 %.2f, full avg10 %.2f",
+             resourceNames[i], stat.someAvg10, stat.fullAvg10);
+    rokid::PressureEventPtr data(new rokid::PressureEvent);
+    data->setResource(resourceNames[i]);
+    data->setStall((int64_t) _triggerStall);
+    data->setWindow((int64_t) _triggerWindow);
+    data->setSomeAvg10(stat.someAvg10);
+    data->setFullAvg10(stat.fullAvg10);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "pressure event");
+  }
+}
+
+void CollectPressure::execute() {
+  if (!_available) {
+    this->onJobDone(0);
+    return;
+  }
+  ASSERT(!_workReq, "CollectPressure is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectPressure, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectPressure, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectPressure::doCollect(uv_work_t *) {
+  for (uint32_t i = 0; i < (uint32_t) PressureResource::COUNT; ++i) {
+    _stats[i] = PressureStat();
+    readPressure(_pressureDir + resourceNames[i], _stats[i]);
+  }
+}
+
+void CollectPressure::afterCollect(uv_work_t *, int status) {
+  if (status == 0) {
+    rokid::PressureInfosPtr data(new rokid::PressureInfos);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::PressureInfo>> pressures(
+      new std::vector<rokid::PressureInfo>()
+    );
+    for (uint32_t i = 0; i < (uint32_t) PressureResource::COUNT; ++i) {
+      auto &stat = _stats[i];
+      auto &last = _lastStats[i];
+      if (!stat.valid) {
+        continue;
+      }
+      // total is the accumulated stall time in us
+      uint64_t someDelta = last.valid ? stat.someTotal - last.someTotal : 0;
+      uint64_t fullDelta = last.valid ? stat.fullTotal - last.fullTotal : 0;
+      LOG_VERBOSE("pressure %s: some %.2f %.2f +%" PRIu64 "us, "
+                  "full %.2f %.2f +%" PRIu64 "us",
+                  resourceNames[i], stat.someAvg10, stat.someAvg60,
+                  someDelta, stat.fullAvg10, stat.fullAvg60, fullDelta);
+      pressures->emplace_back();
+      auto &info = pressures->back();
+      info.setResource(resourceNames[i]);
+      info.setSomeAvg10(stat.someAvg10);
+      info.setSomeAvg60(stat.someAvg60);
+      info.setSomeTotal((int64_t) someDelta);
+      info.setFullAvg10(stat.fullAvg10);
+      info.setFullAvg60(stat.fullAvg60);
+      info.setFullTotal((int64_t) fullDelta);
+      last = stat;
+    }
+    data->setPressures(pressures);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "pressure data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectPressure::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
@@ -0,0 +1,80 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_PRESSURE_H
+#define YODA_SIXSIX_COLLECT_PRESSURE_H
+
+#include "executor_def.h"
+#include <atomic>
+#include <thread>
+
+YODA_NS_BEGIN
+
+enum class PressureResource : uint32_t {
+  CPU = 0,
+  MEMORY,
+  IO,
+  COUNT
+};
+
+struct PressureStat {
+  bool valid = false;
+  float someAvg10 = 0.0f;
+  float someAvg60 = 0.0f;
+  uint64_t someTotal = 0;
+  float fullAvg10 = 0.0f;
+  float fullAvg60 = 0.0f;
+  uint64_t fullTotal = 0;
+};
+
+/*
+ * Collects /proc/pressure/{cpu,memory,io}. A crossed PSI trigger is sent at
+ * once as a PressureEvent. Does nothing if the kernel has no PSI.
+ *
+ * libuv can not wait for POLLPRI, so a thread waits on the trigger fds and
+ * wakes the loop through an eventfd watched by a uv_poll_t.
+ */
+class CollectPressure : public IJobExecutor {
+public:
+  CollectPressure();
+
+  ~CollectPressure() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  void startTriggers(uint64_t stallUs, uint64_t windowUs);
+
+  void stopTriggers();
+
+  void watchTriggers();
+
+  void onTrigger(uv_poll_t *handle, int status, int events);
+
+  std::string _pressureDir;
+  bool _available;
+  uv_work_t *_workReq;
+  PressureStat _stats[(uint32_t) PressureResource::COUNT];
+  PressureStat _lastStats[(uint32_t) PressureResource::COUNT];
+  uint64_t _triggerStall;
+  uint64_t _triggerWindow;
+  int _triggerFds[(uint32_t) PressureResource::COUNT];
+  int _notifyFd;
+  int _stopFd;
+  std::atomic<uint32_t> _fired;
+  std::atomic<uint32_t> _failed;
+  std::thread _watcher;
+  uv_poll_t *_poll;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_PRESSURE_H
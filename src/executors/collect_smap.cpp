@@ -5,27 +5,97 @@
 #include "collect_smap.h"
 #include "busy_box.h"
 #include "options.h"
-#include "util.h"
+
+// cpu time a walk may spend at once after an idle period
+#define PACE_BURST_US (20 * 1000)
 
 YODA_NS_BEGIN
 
 CollectSmap::CollectSmap() : IJobExecutor("CollectSmap"),
                              _scanDir(),
-                             _usleepTime(0),
+                             _rollup(false),
+                             _intervalMs(0),
+                             _lastPassMs(0),
+                             _streamParser(false),
+                             _parser(),
                              _workReq(nullptr),
+                             _pacer(Options::get<double>("smapCpuBudget", 1) /
+                                    100, PACE_BURST_US),
+                             _paceTimer(nullptr),
+                             _walking(false),
+                             _waitMs(0),
+                             _passStartMs(0),
+                             _passStartCpuUs(0),
+                             _yields(0),
+                             _pidEnumerator(),
                              _smaps(),
-                             _sysMem(nullptr) {
+                             _sysMem(nullptr),
+                             _fileCount(0),
+                             _fileIntervalMs(0),
+                             _lastFileScanMs(0),
+                             _fileScanned(false),
+                             _fileWalking(false),
+                             _fileBatch(0),
+                             _fileLeft(0),
+                             _filePids(),
+                             _fileNext(0),
+                             _files(),
+                             _fileIds(),
+                             _incremental(false),
+                             _rssThreshold(0),
+                             _maxCacheAge(0),
+                             _cache(),
+                             _signals(),
+                             _cachedCount(0) {
   _scanDir = Options::get<std::string>("sysroot", "") + "/proc";
-  _usleepTime = (Options::get<uint64_t>("smapSleep", 1000)) * 1000;
-  LOG_INFO("smap sleep time %" PRIu64 "ms", _usleepTime / 1000);
+  LOG_INFO("smap cpu budget %.2f%%",
+           Options::get<double>("smapCpuBudget", 1));
+  _rollup = Options::get<uint32_t>("smapRollup", 1) != 0 &&
+            busybox::hasSmapsRollup(_scanDir);
+  LOG_INFO("smap read %s", _rollup ? "smaps_rollup" : "smaps");
+  _intervalMs = Options::get<uint64_t>("smapInterval",
+                                       _rollup ? 5000 : 300 * 1000);
+  LOG_INFO("smap interval %" PRIu64 "ms", _intervalMs);
+  _streamParser = Options::get<uint32_t>("smapStreamParser", 1) != 0;
+  // pss by mapped file needs the full smaps, with smaps_rollup it is only
+  // walked every smapFileInterval
+  _fileCount = Options::get<uint32_t>("smapFileCount", 20);
+  _fileIntervalMs = Options::get<uint64_t>("smapFileInterval", 300 * 1000);
+  _fileBatch = std::max<uint32_t>(Options::get<uint32_t>("smapFileBatch", 8),
+                                  1);
+  // a full smaps parse only for processes whose rss or mapping count moved
+  _incremental = Options::get<uint32_t>("smapIncremental", 1) != 0;
+  _rssThreshold = Options::get<uint32_t>("smapRssThreshold", 5);
+  _maxCacheAge = Options::get<uint32_t>("smapMaxCacheAge", 10);
+  _paceTimer = new uv_timer_t;
+  uv_timer_init(uv_default_loop(), _paceTimer);
 }
 
 CollectSmap::~CollectSmap() {
   ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+  this->abortWalk();
+  _paceTimer->data = nullptr;
+  uv_close((uv_handle_t *) _paceTimer, [](uv_handle_t *handle) {
+    delete (uv_timer_t *) handle;
+  });
+  _paceTimer = nullptr;
 }
 
 void CollectSmap::execute() {
-  ASSERT(!_workReq, "CollectSmap is running");
+  ASSERT(!_workReq && !_walking, "CollectSmap is running");
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  // the job runs at the shortest default interval
+  if (_lastPassMs != 0 && nowMs - _lastPassMs < _intervalMs) {
+    this->onJobDone(0);
+    return;
+  }
+  _passStartMs = nowMs;
+  _passStartCpuUs = _pacer.usedUs();
+  _yields = 0;
+  this->queueWork();
+}
+
+void CollectSmap::queueWork() {
   _workReq = new uv_work_t;
   UV_CB_WRAP1(_workReq, cb1, CollectSmap, doCollect, uv_work_t);
   UV_CB_WRAP2(_workReq, cb2, CollectSmap, afterCollect, uv_work_t, int);
@@ -33,6 +103,12 @@ void CollectSmap::execute() {
 }
 
 int CollectSmap::stop() {
+  if (uv_is_active((uv_handle_t *) _paceTimer)) {
+    // between two chunks of a walk, nothing runs on the thread pool
+    uv_timer_stop(_paceTimer);
+    this->abortWalk();
+    return 0;
+  }
   if (!_workReq) {
     return 0;
   }
@@ -43,27 +119,203 @@ int CollectSmap::stop() {
   return r;
 }
 
+/*
+ * walks the pids until the pacer runs out of cpu budget, the walk is
+ * resumed by a later chunk then, so no thread pool thread sleeps
+ */
 void CollectSmap::doCollect(uv_work_t *) {
-  Util::scanDir(_scanDir, [this](const char *filename) {
-    uint32_t pid;
-    // determine if file is pid dir
-    if (Util::lexicalCast<uint32_t>(filename, &pid)) {
-      std::string pidDir = _scanDir + "/" + filename;
-      if (Util::isDir(pidDir)) {
-        auto smap = busybox::getProcessSmap(pidDir, pid);
-        if (smap) {
-          _smaps.emplace_back(smap);
-        }
+  if (!_walking) {
+    this->beginWalk();
+  }
+  _waitMs = 0;
+  _pacer.resume();
+  uint32_t pid;
+  while (_pidEnumerator.next(&pid)) {
+    this->collectPid(pid);
+    _waitMs = _pacer.charge();
+    if (_waitMs > 0) {
+      return;
+    }
+  }
+  while (_fileLeft > 0 && _fileNext < _filePids.size()) {
+    --_fileLeft;
+    this->collectFilePid(_filePids[_fileNext++]);
+    _waitMs = _pacer.charge();
+    if (_waitMs > 0) {
+      return;
+    }
+  }
+  this->endWalk();
+}
+
+void CollectSmap::beginWalk() {
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  _fileScanned = false;
+  if (_fileCount > 0 && !_fileWalking &&
+      (_lastFileScanMs == 0 || nowMs - _lastFileScanMs >= _fileIntervalMs)) {
+    _lastFileScanMs = nowMs;
+    _files.beginScan();
+    if (_rollup) {
+      // parsing every pid in one collect would hold back the rollup totals
+      // for minutes on a busy device
+      _filePids.clear();
+      _fileNext = 0;
+      _pidEnumerator.open(_scanDir);
+      uint32_t pid;
+      while (_pidEnumerator.next(&pid)) {
+        _filePids.push_back(pid);
       }
-      usleep(_usleepTime);
+      _pidEnumerator.close();
+      _fileWalking = true;
+    } else {
+      _fileScanned = true;
     }
-  });
+  }
+  _fileLeft = _fileWalking ? _fileBatch : 0;
+  for (auto &item : _cache) {
+    item.second.seen = false;
+  }
+  _cachedCount = 0;
+  _pidEnumerator.open(_scanDir);
+  _walking = true;
+}
+
+void CollectSmap::collectPid(uint32_t pid) {
+  std::string pidDir = _scanDir + "/" + std::to_string(pid);
+  if (_rollup) {
+    auto smap = busybox::getProcessSmapRollup(pidDir, pid);
+    if (smap) {
+      _smaps.emplace_back(smap);
+    }
+    return;
+  }
+  SmapFileTable *files = _fileScanned ? &_files : nullptr;
+  bool hasSignals = false;
+  if (_incremental &&
+      this->reuseSmap(pid, pidDir, files == nullptr, &hasSignals)) {
+    return;
+  }
+  auto smap = _streamParser
+              ? busybox::getProcessSmap(pidDir, pid, _parser, files)
+              : busybox::getProcessSmap(pidDir, pid, files);
+  if (smap) {
+    _smaps.emplace_back(smap);
+    if (hasSignals) {
+      _signals.seen = true;
+      _signals.smap = smap;
+      _cache[pid] = _signals;
+    }
+  }
+}
+
+/*
+ * the mappings of pid into _files, its totals came from smaps_rollup
+ */
+void CollectSmap::collectFilePid(uint32_t pid) {
+  std::string pidDir = _scanDir + "/" + std::to_string(pid);
+  if (_streamParser) {
+    busybox::getProcessSmap(pidDir, pid, _parser, &_files);
+  } else {
+    busybox::getProcessSmap(pidDir, pid, &_files);
+  }
+}
+
+void CollectSmap::endWalk() {
+  _pidEnumerator.close();
+  _walking = false;
+  for (auto ite = _cache.begin(); ite != _cache.end();) {
+    if (ite->second.seen) {
+      ++ite;
+    } else {
+      ite = _cache.erase(ite);
+    }
+  }
+  _signals.smap.reset();
+  if (_fileWalking && _fileNext >= _filePids.size()) {
+    _fileWalking = false;
+    _fileScanned = true;
+  }
+  if (_fileScanned) {
+    _files.top(_fileCount, _fileIds);
+  }
 
   _sysMem = busybox::getSystemMemory(_scanDir);
 }
 
+void CollectSmap::abortWalk() {
+  if (!_walking) {
+    return;
+  }
+  _pidEnumerator.close();
+  _walking = false;
+  _signals.smap.reset();
+  _smaps.clear();
+  // sums of a part of the processes, a file walk after the rollup walk goes
+  // on with the pid it stopped at
+  if (_fileScanned) {
+    _fileScanned = false;
+    _lastFileScanMs = 0;
+  }
+}
+
+/*
+ * reuse the last smaps of pid if rss moved less than _rssThreshold percent
+ * and the mapping count is the same. The signals are kept in _signals for
+ * the parse otherwise, which a file scan always does
+ */
+bool CollectSmap::reuseSmap(uint32_t pid, const std::string &pidDir,
+                            bool reuse, bool *hasSignals) {
+  auto &signals = _signals;
+  signals.startTime = 0;
+  signals.age = 0;
+  // rss of the last top tick saves the statm read
+  auto table = busybox::topSampler().snapshot();
+  int64_t row = table ? table->find(pid) : -1;
+  if (row >= 0) {
+    signals.rss = table->rss((size_t) row);
+    signals.startTime = table->startTime((size_t) row);
+  }
+  *hasSignals = busybox::getSmapSignals(pidDir,
+                                        row >= 0 ? nullptr : &signals.rss,
+                                        &signals.mapsLines);
+  if (!*hasSignals || !reuse) {
+    return false;
+  }
+  auto ite = _cache.find(pid);
+  if (ite == _cache.end()) {
+    return false;
+  }
+  auto &entry = ite->second;
+  uint64_t rssDelta = signals.rss > entry.rss ? signals.rss - entry.rss
+                                              : entry.rss - signals.rss;
+  // the pss of a process changes with sharers too, parse it now and then
+  if (entry.age >= _maxCacheAge ||
+      signals.mapsLines != entry.mapsLines ||
+      rssDelta * 100 > entry.rss * _rssThreshold ||
+      (signals.startTime && entry.startTime &&
+       signals.startTime != entry.startTime)) {
+    return false;
+  }
+  ++entry.age;
+  entry.seen = true;
+  std::shared_ptr<ProcessSmapInfo> smap(new ProcessSmapInfo(*entry.smap));
+  smap->cached = true;
+  _smaps.emplace_back(smap);
+  ++_cachedCount;
+  return true;
+}
+
 void CollectSmap::afterCollect(uv_work_t *, int status) {
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  if (status == 0 && _walking) {
+    ++_yields;
+    UV_CB_WRAP1(_paceTimer, cb, CollectSmap, onPaceTimer, uv_timer_t);
+    uv_timer_start(_paceTimer, cb, _waitMs, 0);
+    return;
+  }
   if (status == 0) {
+    uint64_t durationMs = uv_hrtime() / 1000000 - _passStartMs;
+    uint64_t cpuUs = _pacer.usedUs() - _passStartCpuUs;
     rokid::MemInfosPtr data(new rokid::MemInfos);
     data->setTimestamp(time(nullptr));
 
@@ -76,6 +328,12 @@ void CollectSmap::afterCollect(uv_work_t *, int status) {
     LOG_INFO("sys mem: total %" PRIi64 " available %" PRIi64,
                      _sysMem->total, _sysMem->available);
     data->setSysMem(sysMem);
+    LOG_INFO("smap %zu processes, %u cached, %" PRIu64 "ms, cpu %" PRIu64
+             "us, %u yields", _smaps.size(), _cachedCount, durationMs, cpuUs,
+             _yields);
+    data->setScanDuration(durationMs);
+    data->setScanCpuTime(cpuUs);
+    data->setScanYields(_yields);
 
     std::shared_ptr<std::vector<rokid::ProcMemInfo>> procMems(
       new std::vector<rokid::ProcMemInfo>()
@@ -92,11 +350,14 @@ void CollectSmap::afterCollect(uv_work_t *, int status) {
         mem.setPrivateDirty(smap->private_dirty);
         mem.setSharedClean(smap->shared_clean);
         mem.setSharedDirty(smap->shared_dirty);
-        LOG_VERBOSE("%d %s, rss: %" PRIi64, " pss %", PRIi64,
+        mem.setSwap(smap->swap);
+        mem.setCached(smap->cached ? 1 : 0);
+        LOG_VERBOSE("%u %s, rss: %" PRIu64 " pss: %" PRIu64 " swap: %" PRIu64,
                          smap->pid,
                          smap->fullname.c_str(),
                          smap->rss,
-                         smap->pss);
+                         smap->pss,
+                         smap->swap);
       }
     }
     data->setProcMemInfo(procMems);
@@ -104,15 +365,54 @@ void CollectSmap::afterCollect(uv_work_t *, int status) {
     std::shared_ptr<Caps> caps;
     data->serialize(caps);
     this->sendData(caps, "smap data");
+
+    if (_fileScanned) {
+      this->sendSmapFiles();
+    }
   } else {
     LOG_ERROR("smap collect error status: %d", status);
+    this->abortWalk();
   }
 
-  YODA_SIXSIX_SAFE_DELETE(_workReq);
   _smaps.clear();
   _sysMem.reset();
+  _lastPassMs = uv_hrtime() / 1000000;
 
   this->onJobDone(0);
 }
 
+void CollectSmap::onPaceTimer(uv_timer_t *) {
+  this->queueWork();
+}
+
+void CollectSmap::sendSmapFiles() {
+  rokid::SmapFileInfosPtr data(new rokid::SmapFileInfos);
+  data->setTimestamp(time(nullptr));
+  data->setTotalPss(_files.totalPss());
+  LOG_VERBOSE("smap files: %zu paths, total pss %" PRIu64,
+              _files.size(), _files.totalPss());
+  std::shared_ptr<std::vector<rokid::SmapFileInfo>> files(
+    new std::vector<rokid::SmapFileInfo>()
+  );
+  for (auto id : _fileIds) {
+    auto path = _files.path(id);
+    LOG_VERBOSE("smap file %s: pss %" PRIu64 " rss %" PRIu64
+                " swap %" PRIu64 " in %u processes",
+                path.c_str(), _files.pss(id), _files.rss(id), _files.swap(id),
+                _files.processes(id));
+    files->emplace_back();
+    auto &info = files->back();
+    info.setPath(path.c_str());
+    info.setPss(_files.pss(id));
+    info.setRss(_files.rss(id));
+    info.setSwap(_files.swap(id));
+    info.setProcesses(_files.processes(id));
+  }
+  data->setFiles(files);
+
+  std::shared_ptr<Caps> caps;
+  data->serialize(caps);
+  this->sendData(caps, "smap file data");
+}
+
 YODA_NS_END
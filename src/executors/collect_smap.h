@@ -6,6 +6,11 @@
 #define YODA_SIXSIX_COLLECT_SMAP_H
 
 #include "executor_def.h"
+#include <unordered_map>
+#include "pid_enumerator.h"
+#include "smap_files.h"
+#include "smaps_parser.h"
+#include "cpu_pacer.h"
 
 YODA_NS_BEGIN
 
@@ -21,15 +26,81 @@ public:
 
 protected:
 
+  void queueWork();
+
   virtual void doCollect(uv_work_t *req);
 
   void afterCollect(uv_work_t *req, int code);
 
+  void onPaceTimer(uv_timer_t *handle);
+
+  void beginWalk();
+
+  void collectPid(uint32_t pid);
+
+  void collectFilePid(uint32_t pid);
+
+  void endWalk();
+
+  void abortWalk();
+
+  void sendSmapFiles();
+
+  bool reuseSmap(uint32_t pid, const std::string &pidDir, bool reuse,
+                 bool *hasSignals);
+
+  struct SmapCacheEntry {
+    uint64_t startTime;
+    uint64_t rss;
+    uint32_t mapsLines;
+    // scans reused since the last parse
+    uint32_t age;
+    bool seen;
+    std::shared_ptr<ProcessSmapInfo> smap;
+  };
+
   std::string _scanDir;
-  uint64_t _usleepTime;
+  bool _rollup;
+  // smaps_rollup is cheap enough to be read every few seconds
+  uint64_t _intervalMs;
+  uint64_t _lastPassMs;
+  // fgets line by line if not set
+  bool _streamParser;
+  SmapsParser _parser;
   uv_work_t *_workReq;
+  CpuPacer _pacer;
+  // resumes the walk once the pacer has tokens again
+  uv_timer_t *_paceTimer;
+  // the pid walk of a collect is in progress, across work chunks
+  bool _walking;
+  uint64_t _waitMs;
+  uint64_t _passStartMs;
+  uint64_t _passStartCpuUs;
+  uint32_t _yields;
+  PidEnumerator _pidEnumerator;
   std::list<std::shared_ptr<ProcessSmapInfo>> _smaps;
   std::shared_ptr<SystemMemoryInfo> _sysMem;
+  size_t _fileCount;
+  uint64_t _fileIntervalMs;
+  uint64_t _lastFileScanMs;
+  // whether the last collect completed _files
+  bool _fileScanned;
+  // with smaps_rollup the full smaps of _filePids are parsed into _files
+  // up to _fileBatch pids per collect, after the rollup walk
+  bool _fileWalking;
+  uint32_t _fileBatch;
+  uint32_t _fileLeft;
+  std::vector<uint32_t> _filePids;
+  size_t _fileNext;
+  SmapFileTable _files;
+  std::vector<uint32_t> _fileIds;
+  bool _incremental;
+  uint32_t _rssThreshold;
+  uint32_t _maxCacheAge;
+  std::unordered_map<uint32_t, SmapCacheEntry> _cache;
+  // signals of the pid being collected, stored once it is parsed
+  SmapCacheEntry _signals;
+  uint32_t _cachedCount;
 };
 
 YODA_NS_END
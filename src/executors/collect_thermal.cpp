@@ -0,0 +1,103 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_thermal.h"
+#include "options.h"
+
+YODA_NS_BEGIN
+
+CollectThermal::CollectThermal() : IJobExecutor("CollectThermal"),
+                                   _available(false),
+                                   _workReq(nullptr),
+                                   _reader(Options::get<std::string>(
+                                     "sysroot", "")) {
+  _available = _reader.open() > 0;
+  if (!_available) {
+    LOG_INFO("no thermal zone found, skip thermal collect");
+    return;
+  }
+  LOG_INFO("thermal: %zu zones, %zu cooling devices",
+           _reader.zones().size(), _reader.coolingDevices().size());
+}
+
+CollectThermal::~CollectThermal() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectThermal::execute() {
+  if (!_available) {
+    this->onJobDone(0);
+    return;
+  }
+  ASSERT(!_workReq, "CollectThermal is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectThermal, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectThermal, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectThermal::doCollect(uv_work_t *) {
+  _reader.read();
+}
+
+void CollectThermal::afterCollect(uv_work_t *, int status) {
+  if (status == 0) {
+    rokid::ThermalInfosPtr data(new rokid::ThermalInfos);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::ThermalZone>> zones(
+      new std::vector<rokid::ThermalZone>()
+    );
+    for (auto &zone : _reader.zones()) {
+      if (!zone.valid) {
+        continue;
+      }
+      LOG_VERBOSE("thermal %s %s: %d", zone.name.c_str(), zone.type.c_str(),
+                  zone.temp);
+      zones->emplace_back();
+      auto &info = zones->back();
+      info.setName(zone.name.c_str());
+      info.setType(zone.type.c_str());
+      info.setTemp(zone.temp);
+    }
+    data->setZones(zones);
+    std::shared_ptr<std::vector<rokid::CoolingDevice>> devices(
+      new std::vector<rokid::CoolingDevice>()
+    );
+    for (auto &device : _reader.coolingDevices()) {
+      if (!device.valid) {
+        continue;
+      }
+      LOG_VERBOSE("cooling %s %s: %d/%d", device.name.c_str(),
+                  device.type.c_str(), device.curState, device.maxState);
+      devices->emplace_back();
+      auto &info = devices->back();
+      info.setName(device.name.c_str());
+      info.setType(device.type.c_str());
+      info.setCurState(device.curState);
+      info.setMaxState(device.maxState);
+    }
+    data->setCoolingDevices(devices);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "thermal data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectThermal::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
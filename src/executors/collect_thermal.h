@@ -0,0 +1,40 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_THERMAL_H
+#define YODA_SIXSIX_COLLECT_THERMAL_H
+
+#include "executor_def.h"
+#include "thermal.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends the temperature of every thermal zone together with the state of
+ * every cooling device, so throttling can be matched with cpu frequency.
+ */
+class CollectThermal : public IJobExecutor {
+public:
+  CollectThermal();
+
+  ~CollectThermal() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  bool _available;
+  uv_work_t *_workReq;
+  ThermalReader _reader;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_THERMAL_H
@@ -5,20 +5,57 @@
 #include "collect_top.h"
 #include "options.h"
 #include "busy_box.h"
+#include "proc_connector.h"
+#include "process_table.h"
+#include "cpu_freq.h"
+#include <algorithm>
 
 YODA_NS_BEGIN
 
 CollectTop::CollectTop() : IJobExecutor("CollectTop"),
                            _workReq(nullptr),
-                           _top(nullptr) {
+                           _top(nullptr),
+                           _procConnector(nullptr),
+                           _ioSampler(nullptr),
+                           _ioCount(0),
+                           _ioRates(nullptr),
+                           _waitersCount(0),
+                           _waiterRows(),
+                           _totalWait(0) {
   auto sysroot = Options::get<std::string>("sysroot", "");
   _scanDir = sysroot + "/proc";
+  auto &sampler = busybox::topSampler();
+  sampler.setProcFdCache(Options::get<uint32_t>("topFdCache", 0) != 0);
+  sampler.setScanThreads(Options::get<uint32_t>("topScanThreads", 1),
+                         Options::get<uint32_t>("topScanWindow", 0));
+  if (Options::get<uint32_t>("procConnector", 0) != 0) {
+    _procConnector.reset(new ProcConnector(_scanDir));
+    // fall back to listing the proc dir, e.g. without CAP_NET_ADMIN
+    if (_procConnector->start(uv_default_loop()) == 0) {
+      sampler.setProcConnector(
+        _procConnector, Options::get<uint32_t>("procReconcileInterval", 60));
+    } else {
+      _procConnector.reset();
+    }
+  }
+  // io of the busiest processes only, every /proc/<pid>/io is a read more
+  _ioCount = Options::get<uint32_t>("topIOCount", 0);
+  if (_ioCount > 0) {
+    _ioSampler.reset(new ProcIOSampler());
+  }
+  // a schedstat read more per process
+  _waitersCount = Options::get<uint32_t>("topWaiters", 0);
+  sampler.setSchedStat(_waitersCount > 0);
   // generate data first time
-  busybox::getSystemTop(_scanDir);
+  sampler.sample(_scanDir);
 }
 
 CollectTop::~CollectTop() {
   ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+  if (_procConnector) {
+    busybox::topSampler().setProcConnector(nullptr, 0);
+    _procConnector->stop();
+  }
 }
 
 void CollectTop::execute() {
@@ -31,36 +68,75 @@ void CollectTop::execute() {
 }
 
 void CollectTop::doCollect(uv_work_t *) {
-  _top = busybox::getSystemTop(_scanDir);
+  _top = busybox::topSampler().sample(_scanDir);
+  if (_ioSampler) {
+    _ioRates = &_ioSampler->sample(_scanDir, *_top->processes, _ioCount);
+  }
+  if (_waitersCount > 0) {
+    this->collectWaiters();
+  }
+}
+
+void CollectTop::collectWaiters() {
+  auto &processes = *_top->processes;
+  _waiterRows.clear();
+  _totalWait = 0;
+  for (size_t row = 0; row < processes.size(); ++row) {
+    if (processes.waitDelta(row) > 0) {
+      _waiterRows.push_back(row);
+      _totalWait += processes.waitDelta(row);
+    }
+  }
+  size_t count = std::min(_waitersCount, _waiterRows.size());
+  std::partial_sort(_waiterRows.begin(), _waiterRows.begin() + count,
+                    _waiterRows.end(), [&processes](size_t a, size_t b) {
+                      return processes.waitDelta(a) > processes.waitDelta(b);
+                    });
+  _waiterRows.resize(count);
 }
 
 void CollectTop::afterCollect(uv_work_t *, int32_t status) {
   LOG_VERBOSE("========== busy idle iowait sys usr ==========");
   if (status == 0) {
+    LOG_VERBOSE("proc syscalls %u, cached fds %zu, full scan %d, exited %u",
+                _top->syscalls, _top->cachedFds, _top->fullScan, _top->exited);
+    if (_top->skipped > 0) {
+      LOG_WARN("top scan window exceeded, %u pids skipped", _top->skipped);
+    }
     rokid::CPUInfosPtr data(new rokid::CPUInfos);
     data->setTimestamp(time(nullptr));
 
     std::shared_ptr<std::vector<rokid::ProcCPUInfo>> procList(
       new std::vector<rokid::ProcCPUInfo>()
     );
-    for (auto &pair : _top->processes) {
-      if (pair.second->cpuUsagePercent > 0.0f) {
-        auto &proc = pair.second;
-        LOG_VERBOSE("process %d %s: %f, nice %d",
-                         proc->pid,
-                         proc->fullname.c_str(),
-                         proc->cpuUsagePercent,
-                         proc->nice);
+    auto &processes = *_top->processes;
+    for (size_t row = 0; row < processes.size(); ++row) {
+      if (processes.cpuUsagePercent(row) > 0.0f) {
+        auto &fullname = processes.identity(row).fullname;
+        LOG_VERBOSE("process %d %s: %f, nice %d, flt %.1f/%.1f, "
+                    "csw %.1f/%.1f",
+                         processes.pid(row),
+                         fullname.c_str(),
+                         processes.cpuUsagePercent(row),
+                         processes.nice(row),
+                         processes.minFltRate(row),
+                         processes.majFltRate(row),
+                         processes.nvcswRate(row),
+                         processes.nivcswRate(row));
         procList->emplace_back();
         rokid::ProcCPUInfo &procCpu = procList->back();
-        procCpu.setPid(proc->pid);
-        procCpu.setFullName(proc->fullname.c_str());
-        procCpu.setStatus(proc->state);
-        procCpu.setCpuUsage(proc->cpuUsagePercent);
-        procCpu.setNice(proc->nice);
-        procCpu.setStime(proc->stime);
-        procCpu.setUtime(proc->utime);
-        procCpu.setTicks(proc->ticks);
+        procCpu.setPid(processes.pid(row));
+        procCpu.setFullName(fullname.c_str());
+        procCpu.setStatus(processes.state(row));
+        procCpu.setCpuUsage(processes.cpuUsagePercent(row));
+        procCpu.setNice(processes.nice(row));
+        procCpu.setStime(processes.stime(row));
+        procCpu.setUtime(processes.utime(row));
+        procCpu.setTicks(processes.ticks(row));
+        procCpu.setMinFltRate(processes.minFltRate(row));
+        procCpu.setMajFltRate(processes.majFltRate(row));
+        procCpu.setNvcswRate(processes.nvcswRate(row));
+        procCpu.setNivcswRate(processes.nivcswRate(row));
       }
     }
     data->setProcCpuList(procList);
@@ -69,15 +145,23 @@ void CollectTop::afterCollect(uv_work_t *, int32_t status) {
     std::shared_ptr<std::vector<rokid::SysCPUCoreInfo>> coresInfo(
       new std::vector<rokid::SysCPUCoreInfo>()
     );
-    int32_t i = 0;
+    uint32_t online = 0;
+    float capacitySum = 0.0f;
+    // of the last cpufreq collect, the files are only read there
+    auto scales = CpuFreqReader::published();
     for (auto &core : _top->cpu->cores) {
-      LOG_VERBOSE("core: %d %f %f %f %f %f",
-                       i++,
+      float capacity = core->busyPercent *
+                       (scales && core->cpu < scales->size()
+                        ? (*scales)[core->cpu] : 1.0f);
+      LOG_VERBOSE("core: %u%s %f %f %f %f %f %f",
+                       core->cpu,
+                       core->online ? "" : " offline",
                        core->busyPercent,
                        core->idlePercent,
                        core->iowaitPercent,
                        core->sysPercent,
-                       core->usrPercent
+                       core->usrPercent,
+                       capacity
       );
       coresInfo->emplace_back();
       auto &coreData = coresInfo->back();
@@ -86,6 +170,13 @@ void CollectTop::afterCollect(uv_work_t *, int32_t status) {
       coreData.setIoUsage(core->iowaitPercent);
       coreData.setSysUsage(core->sysPercent);
       coreData.setUsrUsage(core->usrPercent);
+      coreData.setCapacityUsage(capacity);
+      coreData.setCpu(core->cpu);
+      coreData.setOnline(core->online ? 1 : 0);
+      if (core->online) {
+        capacitySum += capacity;
+        ++online;
+      }
     }
     sysCpuInfo->setCores(coresInfo);
 
@@ -102,6 +193,10 @@ void CollectTop::afterCollect(uv_work_t *, int32_t status) {
     total->setIoUsage(_top->cpu->total->iowaitPercent);
     total->setSysUsage(_top->cpu->total->sysPercent);
     total->setUsrUsage(_top->cpu->total->usrPercent);
+    total->setCapacityUsage(online > 0 ? capacitySum / online : 0.0f);
+    // cpu ids start at 0, -1 marks the total of all cpus
+    total->setCpu(-1);
+    total->setOnline(1);
     sysCpuInfo->setTotal(total);
 
     data->setSysCpu(sysCpuInfo);
@@ -109,14 +204,105 @@ void CollectTop::afterCollect(uv_work_t *, int32_t status) {
     std::shared_ptr<Caps> caps;
     data->serialize(caps);
     this->sendData(caps, "cpu data");
+
+    auto &counters = _top->cpu->counters;
+    LOG_VERBOSE("ctxt %.1f/s, intr %.1f/s, softirq %.1f/s, fork %.1f/s, "
+                "running %u, blocked %u",
+                counters.ctxtRate, counters.intrRate, counters.softirqRate,
+                counters.forkRate, counters.procsRunning,
+                counters.procsBlocked);
+    rokid::SysCountersPtr countersData(new rokid::SysCounters);
+    countersData->setCtxtRate(counters.ctxtRate);
+    countersData->setIntrRate(counters.intrRate);
+    countersData->setSoftirqRate(counters.softirqRate);
+    countersData->setForkRate(counters.forkRate);
+    countersData->setProcsRunning(counters.procsRunning);
+    countersData->setProcsBlocked(counters.procsBlocked);
+    countersData->setTimestamp(time(nullptr));
+    std::shared_ptr<Caps> countersCaps;
+    countersData->serialize(countersCaps);
+    this->sendData(countersCaps, "system counters");
+
+    if (_ioRates) {
+      this->sendProcIO();
+    }
+    if (_waitersCount > 0 && _top->tickMs > 0) {
+      this->sendWaiters();
+    }
   }
 
   YODA_SIXSIX_SAFE_DELETE(_workReq);
   _top.reset();
+  _ioRates = nullptr;
 
   this->onJobDone(0);
 }
 
+void CollectTop::sendProcIO() {
+  rokid::ProcIOInfosPtr data(new rokid::ProcIOInfos);
+  data->setTimestamp(time(nullptr));
+  std::shared_ptr<std::vector<rokid::ProcIOInfo>> ioList(
+    new std::vector<rokid::ProcIOInfo>()
+  );
+  for (auto &rate : *_ioRates) {
+    LOG_VERBOSE("process io %u %s: read %.0fB/s, write %.0fB/s, "
+                "cancelled %.0fB/s, syscr %.1f/s, syscw %.1f/s",
+                rate.pid, rate.identity->fullname.c_str(), rate.readBytes,
+                rate.writeBytes, rate.cancelledWriteBytes, rate.syscr,
+                rate.syscw);
+    ioList->emplace_back();
+    auto &info = ioList->back();
+    info.setPid(rate.pid);
+    info.setFullName(rate.identity->fullname.c_str());
+    info.setReadBytes(rate.readBytes);
+    info.setWriteBytes(rate.writeBytes);
+    info.setCancelledWriteBytes(rate.cancelledWriteBytes);
+    info.setSyscr(rate.syscr);
+    info.setSyscw(rate.syscw);
+  }
+  data->setProcIoList(ioList);
+
+  std::shared_ptr<Caps> caps;
+  data->serialize(caps);
+  this->sendData(caps, "proc io data");
+}
+
+void CollectTop::sendWaiters() {
+  auto &processes = *_top->processes;
+  rokid::SchedWaitInfosPtr data(new rokid::SchedWaitInfos);
+  data->setTimestamp(time(nullptr));
+  data->setTotalWaitMs(_totalWait / 1e6f);
+  data->setTickMs(_top->tickMs);
+  LOG_VERBOSE("runqueue wait %.1fms in %.1fms",
+              _totalWait / 1e6f, _top->tickMs);
+  std::shared_ptr<std::vector<rokid::SchedWaitInfo>> waiters(
+    new std::vector<rokid::SchedWaitInfo>()
+  );
+  for (auto row : _waiterRows) {
+    auto slices = processes.timeslicesDelta(row);
+    float waitMs = processes.waitDelta(row) / 1e6f;
+    float avgWaitUs = slices ? processes.waitDelta(row) / 1e3f / slices : 0;
+    auto &fullname = processes.identity(row).fullname;
+    LOG_VERBOSE("waiter %u %s: wait %.2fms, run %.2fms, %" PRIu64
+                " slices, %.1fus per slice",
+                processes.pid(row), fullname.c_str(), waitMs,
+                processes.runDelta(row) / 1e6f, slices, avgWaitUs);
+    waiters->emplace_back();
+    auto &info = waiters->back();
+    info.setPid(processes.pid(row));
+    info.setFullName(fullname.c_str());
+    info.setWaitMs(waitMs);
+    info.setRunMs(processes.runDelta(row) / 1e6f);
+    info.setTimeslices((uint32_t) slices);
+    info.setAvgWaitUs(avgWaitUs);
+  }
+  data->setWaiters(waiters);
+
+  std::shared_ptr<Caps> caps;
+  data->serialize(caps);
+  this->sendData(caps, "sched wait data");
+}
+
 int CollectTop::stop() {
   if (!_workReq) {
     return 0;
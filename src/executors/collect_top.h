@@ -6,9 +6,12 @@
 #define YODA_SIXSIX_COLLECT_TOP_H
 
 #include "executor_def.h"
+#include "proc_io.h"
 
 YODA_NS_BEGIN
 
+class ProcConnector;
+
 class CollectTop : public IJobExecutor {
 public:
   CollectTop();
@@ -25,9 +28,23 @@ protected:
 
   void afterCollect(uv_work_t *req, int code);
 
+  void sendProcIO();
+
+  void collectWaiters();
+
+  void sendWaiters();
+
   std::string _scanDir;
   uv_work_t *_workReq;
   std::shared_ptr<SystemTopInfo> _top;
+  std::shared_ptr<ProcConnector> _procConnector;
+  std::unique_ptr<ProcIOSampler> _ioSampler;
+  size_t _ioCount;
+  const std::vector<ProcIORate> *_ioRates;
+  size_t _waitersCount;
+  // rows of _top->processes, longest runqueue wait first
+  std::vector<size_t> _waiterRows;
+  uint64_t _totalWait;
 };
 
 YODA_NS_END
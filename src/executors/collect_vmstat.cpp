@@ -0,0 +1,101 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "collect_vmstat.h"
+#include "options.h"
+#include <set>
+
+static const char *defaultCounters =
+  "pgfault,pgmajfault,pswpin,pswpout,pgscan_direct,pgsteal_direct,"
+  "allocstall_normal,allocstall_movable,compact_stall,"
+  "workingset_refault_file,oom_kill";
+
+YODA_NS_BEGIN
+
+CollectVmstat::CollectVmstat() : IJobExecutor("CollectVmstat"),
+                                 _workReq(nullptr),
+                                 _reader(nullptr),
+                                 _readResult(0),
+                                 _missingLogged(false) {
+  auto sysroot = Options::get<std::string>("sysroot", "");
+  auto counters = Options::get<std::string>("vmstatCounters", defaultCounters);
+  std::vector<std::string> names;
+  std::set<std::string> seen;
+  std::stringstream ss(counters);
+  std::string name;
+  while (std::getline(ss, name, ',')) {
+    if (!name.empty() && seen.insert(name).second) {
+      names.push_back(name);
+    }
+  }
+  _reader.reset(new VmstatReader(sysroot + "/proc/vmstat", names));
+}
+
+CollectVmstat::~CollectVmstat() {
+  ASSERT(_workReq == nullptr, "%s work not null", _name.c_str());
+}
+
+void CollectVmstat::execute() {
+  ASSERT(!_workReq, "CollectVmstat is running");
+
+  _workReq = new uv_work_t;
+  UV_CB_WRAP1(_workReq, cb1, CollectVmstat, doCollect, uv_work_t);
+  UV_CB_WRAP2(_workReq, cb2, CollectVmstat, afterCollect, uv_work_t, int);
+  uv_queue_work(uv_default_loop(), _workReq, cb1, cb2);
+}
+
+void CollectVmstat::doCollect(uv_work_t *) {
+  _readResult = _reader->read();
+}
+
+void CollectVmstat::afterCollect(uv_work_t *, int status) {
+  if (status == 0 && _readResult != 0) {
+    LOG_ERROR("read vmstat error: %d", _readResult);
+  } else if (status == 0) {
+    rokid::VmstatInfosPtr data(new rokid::VmstatInfos);
+    data->setTimestamp(time(nullptr));
+    std::shared_ptr<std::vector<rokid::VmstatInfo>> counters(
+      new std::vector<rokid::VmstatInfo>()
+    );
+    auto &names = _reader->names();
+    for (size_t i = 0; i < names.size(); ++i) {
+      if (!_reader->found(i)) {
+        // counters differ between kernel versions
+        if (!_missingLogged) {
+          LOG_WARN("vmstat counter %s not found", names[i].c_str());
+        }
+        continue;
+      }
+      LOG_VERBOSE("vmstat %s: %" PRIu64 ", %.1f/s", names[i].c_str(),
+                  _reader->value(i), _reader->rate(i));
+      counters->emplace_back();
+      auto &info = counters->back();
+      info.setName(names[i].c_str());
+      info.setValue(_reader->value(i));
+      info.setRate(_reader->rate(i));
+    }
+    _missingLogged = true;
+    data->setCounters(counters);
+
+    std::shared_ptr<Caps> caps;
+    data->serialize(caps);
+    this->sendData(caps, "vmstat data");
+  }
+
+  YODA_SIXSIX_SAFE_DELETE(_workReq);
+  this->onJobDone(0);
+}
+
+int CollectVmstat::stop() {
+  if (!_workReq) {
+    return 0;
+  }
+  int r = uv_cancel((uv_req_t *) _workReq);
+  if (r == 0) {
+    YODA_SIXSIX_SAFE_DELETE(_workReq);
+  }
+  return r;
+}
+
+YODA_NS_END
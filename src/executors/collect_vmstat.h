@@ -0,0 +1,41 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_COLLECT_VMSTAT_H
+#define YODA_SIXSIX_COLLECT_VMSTAT_H
+
+#include "executor_def.h"
+#include "vmstat.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Sends the rates of the vmstatCounters of /proc/vmstat, major faults,
+ * swap, direct reclaim and oom kills by default.
+ */
+class CollectVmstat : public IJobExecutor {
+public:
+  CollectVmstat();
+
+  ~CollectVmstat() override;
+
+  void execute() override;
+
+  int stop() override;
+
+protected:
+
+  void doCollect(uv_work_t *req);
+
+  void afterCollect(uv_work_t *req, int status);
+
+  uv_work_t *_workReq;
+  std::unique_ptr<VmstatReader> _reader;
+  int32_t _readResult;
+  bool _missingLogged;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_COLLECT_VMSTAT_H
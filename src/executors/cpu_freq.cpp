@@ -0,0 +1,258 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "cpu_freq.h"
+#include "proc_scan.h"
+#include "util.h"
+#include <algorithm>
+#include <fcntl.h>
+
+#define TIME_IN_STATE_BUFSIZE 1024
+#define TIME_IN_STATE_MAX_BUFSIZE (16 * 1024)
+#define MAX_CAPACITY 1024
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+// only accessed with std::atomic_load/store
+static std::shared_ptr<const std::vector<float>> publishedScales;
+
+static bool readU64(int fd, uint64_t *value) {
+  char buf[32];
+  ssize_t size = pread(fd, buf, sizeof(buf), 0);
+  if (size <= 0) {
+    return false;
+  }
+  const char *cp = buf;
+  return scanU64(cp, buf + size, value);
+}
+
+/*
+ * read a small attribute once, returns false if it is not there
+ */
+static bool readOnce(const std::string &path, int64_t *value) {
+  auto str = Util::readSmallFile(path);
+  if (str.empty()) {
+    return false;
+  }
+  *value = strtoll(str.c_str(), nullptr, 10);
+  return true;
+}
+
+static int openFile(const std::string &path) {
+  return ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+}
+
+static void closeFd(int fd) {
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+CpuFreqReader::CpuFreqReader(const std::string &sysroot) :
+  _cpuDir(sysroot + "/sys/devices/system/cpu/"),
+  _cores(),
+  _buf(TIME_IN_STATE_BUFSIZE),
+  _hasLast(false) {
+
+}
+
+CpuFreqReader::~CpuFreqReader() {
+  for (auto &core : _cores) {
+    closeFd(core.onlineFd);
+    closeFiles(core);
+  }
+}
+
+size_t CpuFreqReader::open() {
+  std::vector<uint32_t> cpus;
+  for (auto &name : Util::getFileList(_cpuDir)) {
+    const char *cp = name.c_str() + 3;
+    uint64_t cpu;
+    if (name.compare(0, 3, "cpu") == 0 &&
+        scanU64(cp, name.c_str() + name.size(), &cpu) && *cp == '\0') {
+      cpus.push_back((uint32_t) cpu);
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  for (auto cpu : cpus) {
+    std::string dir = _cpuDir + "cpu" + std::to_string(cpu) + "/";
+    _cores.emplace_back();
+    auto &core = _cores.back();
+    core.cpu = cpu;
+    core.curFreq = core.avgFreq = 0;
+    core.valid = false;
+    core.onlineFd = openFile(dir + "online");
+    uint64_t online;
+    core.online = core.onlineFd < 0 || !readU64(core.onlineFd, &online) ||
+                  online != 0;
+    int64_t value;
+    if (readOnce(dir + "topology/cluster_id", &value) ||
+        readOnce(dir + "topology/physical_package_id", &value)) {
+      core.cluster = (int32_t) value;
+    } else {
+      core.cluster = -1;
+    }
+    core.capacity = readOnce(dir + "cpu_capacity", &value) ?
+                    (uint32_t) value : MAX_CAPACITY;
+    core.curFreqFd = -1;
+    core.timeInStateFd = -1;
+    this->openFiles(core);
+  }
+  return _cores.size();
+}
+
+/*
+ * the cpufreq and cpuidle files, they are missing while the cpu is offline
+ */
+void CpuFreqReader::openFiles(CpuFreqCore &core) {
+  std::string dir = _cpuDir + "cpu" + std::to_string(core.cpu) + "/";
+  int64_t value;
+  core.maxFreq = readOnce(dir + "cpufreq/cpuinfo_max_freq", &value) ?
+                 (uint32_t) value : 0;
+  core.curFreqFd = openFile(dir + "cpufreq/scaling_cur_freq");
+  core.timeInStateFd = openFile(dir + "cpufreq/stats/time_in_state");
+  core.freqResidency.clear();
+  for (uint32_t i = 0;; ++i) {
+    std::string stateDir = dir + "cpuidle/state" + std::to_string(i) + "/";
+    int timeFd = openFile(stateDir + "time");
+    if (timeFd < 0) {
+      break;
+    }
+    auto name = Util::readSmallFile(stateDir + "name");
+    while (!name.empty() && name.back() == '\n') {
+      name.pop_back();
+    }
+    core.idleResidency.push_back(
+      {name, 0, 0, 0.0f, 0, timeFd, openFile(stateDir + "usage")});
+  }
+}
+
+void CpuFreqReader::closeFiles(CpuFreqCore &core) {
+  closeFd(core.curFreqFd);
+  closeFd(core.timeInStateFd);
+  core.curFreqFd = -1;
+  core.timeInStateFd = -1;
+  for (auto &state : core.idleResidency) {
+    closeFd(state.timeFd);
+    closeFd(state.usageFd);
+  }
+  core.idleResidency.clear();
+}
+
+void CpuFreqReader::readTimeInState(CpuFreqCore &core, bool hasLast) {
+  ssize_t size = readFile("", core.timeInStateFd, _buf,
+                          TIME_IN_STATE_MAX_BUFSIZE);
+  if (size <= 0) {
+    return;
+  }
+  // 1800000 51234, one line per frequency in a fixed order
+  auto &states = core.freqResidency;
+  size_t i = 0;
+  uint64_t weighted = 0;
+  uint64_t total = 0;
+  for (const char *p = _buf.data(), *end = p + size; p < end; ++i) {
+    const char *eol = nextLine(p, end);
+    uint64_t freq;
+    uint64_t time;
+    if (!scanU64(p, eol, &freq) || !scanU64(p, eol, &time)) {
+      break;
+    }
+    p = eol;
+    if (i == states.size()) {
+      states.push_back({(uint32_t) freq, time, 0.0f});
+      hasLast = false;
+      continue;
+    }
+    auto &state = states[i];
+    uint64_t delta = hasLast && time >= state.time ? time - state.time : 0;
+    state.freq = (uint32_t) freq;
+    state.time = time;
+    state.deltaMs = delta * 10.0f;
+    weighted += freq * delta;
+    total += delta;
+  }
+  states.resize(i);
+  if (total > 0) {
+    core.avgFreq = (uint32_t) (weighted / total);
+  }
+}
+
+int32_t CpuFreqReader::read() {
+  if (_cores.empty()) {
+    return -1;
+  }
+  uint64_t value;
+  for (auto &core : _cores) {
+    bool online = core.onlineFd < 0 || !readU64(core.onlineFd, &value) ||
+                  value != 0;
+    // the files opened before the cpu went offline are gone
+    bool reopened = online && !core.online;
+    if (reopened) {
+      closeFiles(core);
+      this->openFiles(core);
+    }
+    core.online = online;
+    // cpufreq reads fail while the cpu is offline
+    core.valid = online && core.curFreqFd >= 0 &&
+                 readU64(core.curFreqFd, &value);
+    if (!core.valid) {
+      continue;
+    }
+    bool hasLast = _hasLast && !reopened;
+    core.curFreq = (uint32_t) value;
+    core.avgFreq = core.curFreq;
+    if (core.timeInStateFd >= 0) {
+      this->readTimeInState(core, hasLast);
+    }
+    for (auto &state : core.idleResidency) {
+      uint64_t time = 0;
+      uint64_t usage = 0;
+      readU64(state.timeFd, &time);
+      if (state.usageFd >= 0) {
+        readU64(state.usageFd, &usage);
+      }
+      bool grew = hasLast && time >= state.time && usage >= state.usage;
+      state.deltaMs = grew ? (time - state.time) / 1000.0f : 0.0f;
+      state.usageDelta = grew ? usage - state.usage : 0;
+      state.time = time;
+      state.usage = usage;
+    }
+  }
+  _hasLast = true;
+  return 0;
+}
+
+float CpuFreqReader::capacityScale(uint32_t cpu) const {
+  auto ite = std::lower_bound(_cores.begin(), _cores.end(), cpu,
+                              [](const CpuFreqCore &core, uint32_t cpu) {
+                                return core.cpu < cpu;
+                              });
+  if (ite == _cores.end() || ite->cpu != cpu || !ite->valid) {
+    return 1.0f;
+  }
+  float scale = (float) ite->capacity / MAX_CAPACITY;
+  if (ite->maxFreq > 0 && ite->avgFreq > 0) {
+    scale *= std::min(1.0f, (float) ite->avgFreq / ite->maxFreq);
+  }
+  return scale;
+}
+
+void CpuFreqReader::publish() const {
+  uint32_t count = _cores.empty() ? 0 : _cores.back().cpu + 1;
+  std::shared_ptr<std::vector<float>> scales(
+    new std::vector<float>(count, 1.0f));
+  for (auto &core : _cores) {
+    (*scales)[core.cpu] = this->capacityScale(core.cpu);
+  }
+  std::atomic_store(&publishedScales,
+                    std::shared_ptr<const std::vector<float>>(scales));
+}
+
+std::shared_ptr<const std::vector<float>> CpuFreqReader::published() {
+  return std::atomic_load(&publishedScales);
+}
+
+YODA_NS_END
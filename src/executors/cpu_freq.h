@@ -0,0 +1,109 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_CPU_FREQ_H
+#define YODA_SIXSIX_CPU_FREQ_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+struct FreqResidency {
+  // kHz
+  uint32_t freq;
+  // time_in_state, in 10ms
+  uint64_t time;
+  float deltaMs;
+};
+
+struct IdleResidency {
+  std::string name;
+  // us
+  uint64_t time;
+  uint64_t usage;
+  float deltaMs;
+  uint64_t usageDelta;
+  int timeFd;
+  int usageFd;
+};
+
+struct CpuFreqCore {
+  uint32_t cpu;
+  // topology/cluster_id, or physical_package_id, -1 if unknown
+  int32_t cluster;
+  // cpu_capacity, 1024 is the biggest core at max frequency
+  uint32_t capacity;
+  // kHz
+  uint32_t curFreq;
+  uint32_t avgFreq;
+  uint32_t maxFreq;
+  // false if the cpu is offline or has no cpufreq
+  bool valid;
+  bool online;
+  std::vector<FreqResidency> freqResidency;
+  std::vector<IdleResidency> idleResidency;
+  // -1 for cpus which can not go offline
+  int onlineFd;
+  int curFreqFd;
+  int timeInStateFd;
+};
+
+/*
+ * Frequency, time_in_state and cpuidle residency of every cpu of
+ * /sys/devices/system/cpu. The cpus and their idle states are listed by
+ * open(), the files stay open and are re-read with pread. The cpufreq and
+ * cpuidle files of a cpu are opened again when it comes back online.
+ */
+class CpuFreqReader {
+public:
+  explicit CpuFreqReader(const std::string &sysroot);
+
+  ~CpuFreqReader();
+
+  /*
+   * list the cpus, returns how many were found
+   */
+  size_t open();
+
+  /*
+   * read every cpu, returns 0 on success
+   */
+  int32_t read();
+
+  const std::vector<CpuFreqCore> &cores() const { return _cores; }
+
+  /*
+   * how much of the biggest core at max frequency one busy percent of cpu
+   * was worth in the last interval, 1 if nothing is known about cpu
+   */
+  float capacityScale(uint32_t cpu) const;
+
+  /*
+   * publish capacityScale of every cpu of the last read
+   */
+  void publish() const;
+
+  /*
+   * capacityScale by cpu id as last published, thread safe, nullptr if
+   * nothing was published. CollectTop takes it instead of reading the
+   * cpufreq files once more
+   */
+  static std::shared_ptr<const std::vector<float>> published();
+
+private:
+  void openFiles(CpuFreqCore &core);
+
+  static void closeFiles(CpuFreqCore &core);
+
+  void readTimeInState(CpuFreqCore &core, bool hasLast);
+
+  std::string _cpuDir;
+  std::vector<CpuFreqCore> _cores;
+  std::vector<char> _buf;
+  bool _hasLast;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_CPU_FREQ_H
@@ -0,0 +1,49 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "cpu_pacer.h"
+#include <algorithm>
+
+YODA_NS_BEGIN
+
+CpuPacer::CpuPacer(double budget, uint64_t burstUs) : _budget(budget),
+                                                      _burstUs(burstUs),
+                                                      _tokens(burstUs),
+                                                      _lastRefillUs(0),
+                                                      _lastCpuUs(0),
+                                                      _usedUs(0) {
+  _lastRefillUs = uv_hrtime() / 1000;
+}
+
+void CpuPacer::resume() {
+  _lastCpuUs = threadCpuUs();
+}
+
+uint64_t CpuPacer::charge() {
+  uint64_t cpuUs = threadCpuUs();
+  uint64_t used = cpuUs - _lastCpuUs;
+  _lastCpuUs = cpuUs;
+  _usedUs += used;
+  if (_budget <= 0) {
+    return 0;
+  }
+  uint64_t nowUs = uv_hrtime() / 1000;
+  _tokens = std::min(_burstUs,
+                     _tokens + (int64_t) ((nowUs - _lastRefillUs) * _budget));
+  _lastRefillUs = nowUs;
+  _tokens -= used;
+  if (_tokens > 0) {
+    return 0;
+  }
+  // until the bucket is back above zero
+  return (uint64_t) (-_tokens / _budget / 1000) + 1;
+}
+
+uint64_t CpuPacer::threadCpuUs() {
+  timespec ts = {};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+YODA_NS_END
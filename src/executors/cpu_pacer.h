@@ -0,0 +1,56 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_CPU_PACER_H
+#define YODA_SIXSIX_CPU_PACER_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Token bucket of cpu time. Tokens are cpu microseconds which refill at
+ * budget per wall clock microsecond, up to burstUs. The cpu time of the
+ * calling thread is charged, so a worker sleeps only once it has spent
+ * its share, not after every unit of work.
+ */
+class CpuPacer {
+public:
+  /*
+   * budget is the share of one core, 0 disables pacing
+   */
+  CpuPacer(double budget, uint64_t burstUs);
+
+  /*
+   * start measuring the calling thread, before the first charge of a
+   * work chunk
+   */
+  void resume();
+
+  /*
+   * charge the cpu time of the calling thread since resume or the last
+   * charge, returns the ms to wait before the next resume if the budget is
+   * used up, otherwise 0
+   */
+  uint64_t charge();
+
+  /*
+   * cpu time charged since the pacer was created
+   */
+  uint64_t usedUs() const { return _usedUs; }
+
+private:
+  static uint64_t threadCpuUs();
+
+  double _budget;
+  int64_t _burstUs;
+  int64_t _tokens;
+  uint64_t _lastRefillUs;
+  uint64_t _lastCpuUs;
+  uint64_t _usedUs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_CPU_PACER_H
@@ -132,9 +132,10 @@ void CrashReporter::compressAndUpload(const std::string &dir,
   std::string fullname = "unknown-name";
   int32_t pid;
   if (Util::lexicalCast<int32_t>(appPid, &pid)) {
-    std::shared_ptr<ProcessTopInfo> process = busybox::getProcessTopCache(pid);
+    std::shared_ptr<ProcessTopInfo> process =
+      busybox::topSampler().findProcess(pid);
     if (process) {
-      fullname = process->fullname;
+      fullname = process->identity->fullname;
     }
   }
   LOG_INFO("%s %s %s", binName, fullname.c_str(), appPid);
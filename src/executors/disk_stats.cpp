@@ -0,0 +1,177 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "disk_stats.h"
+#include "proc_scan.h"
+#include <algorithm>
+
+#define DISK_STATS_BUFSIZE (8 * 1024)
+#define DISK_STATS_MAX_BUFSIZE (256 * 1024)
+#define DISK_SECTOR_SIZE 512
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+enum {
+  READS = 0,
+  READ_SECTORS,
+  READ_MS,
+  WRITES,
+  WRITE_SECTORS,
+  WRITE_MS,
+  IN_FLIGHT,
+  IO_MS,
+  WEIGHTED_IO_MS,
+  COUNTER_COUNT
+};
+
+DiskStatsReader::DiskStatsReader(const std::string &sysroot,
+                                 bool partitions) :
+  _sysroot(sysroot),
+  _path(sysroot + "/proc/diskstats"),
+  _partitions(partitions),
+  _fd(-1),
+  _buf(DISK_STATS_BUFSIZE),
+  _devices(),
+  _stats(),
+  _lastReadMs(0) {
+
+}
+
+DiskStatsReader::~DiskStatsReader() {
+  if (_fd >= 0) {
+    close(_fd);
+  }
+}
+
+DiskStatsReader::Device *DiskStatsReader::findDevice(uint32_t major,
+                                                     uint32_t minor,
+                                                     size_t hint) {
+  if (hint < _devices.size() && _devices[hint].major == major &&
+      _devices[hint].minor == minor) {
+    return &_devices[hint];
+  }
+  for (auto &device : _devices) {
+    if (device.major == major && device.minor == minor) {
+      return &device;
+    }
+  }
+  return nullptr;
+}
+
+bool DiskStatsReader::isPartition(uint32_t major, uint32_t minor) const {
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/dev/block/%u:%u/partition", major, minor);
+  struct stat st;
+  return stat((_sysroot + path).c_str(), &st) == 0;
+}
+
+void DiskStatsReader::updateStat(const Device &device,
+                                 const uint64_t *counters, float ms) {
+  uint64_t delta[COUNTER_COUNT];
+  for (int i = 0; i < COUNTER_COUNT; ++i) {
+    // the counters restart if the driver is reloaded
+    delta[i] = counters[i] >= device.counters[i] ?
+               counters[i] - device.counters[i] : 0;
+  }
+  if (delta[READS] == 0 && delta[WRITES] == 0 && counters[IN_FLIGHT] == 0) {
+    return;
+  }
+  _stats.emplace_back();
+  auto &stat = _stats.back();
+  stat.device = device.name;
+  stat.readIops = delta[READS] * 1000.0f / ms;
+  stat.writeIops = delta[WRITES] * 1000.0f / ms;
+  stat.readBytes = delta[READ_SECTORS] * DISK_SECTOR_SIZE * 1000.0f / ms;
+  stat.writeBytes = delta[WRITE_SECTORS] * DISK_SECTOR_SIZE * 1000.0f / ms;
+  stat.readAwait = delta[READS] ?
+                   (float) delta[READ_MS] / delta[READS] : 0.0f;
+  stat.writeAwait = delta[WRITES] ?
+                    (float) delta[WRITE_MS] / delta[WRITES] : 0.0f;
+  stat.util = std::min(100.0f, delta[IO_MS] * 100.0f / ms);
+  stat.queueDepth = delta[WEIGHTED_IO_MS] / ms;
+  stat.inFlight = (uint32_t) counters[IN_FLIGHT];
+}
+
+/*
+ *  179       0 mmcblk0 2181 610 155146 3000 1337 1474 73618 5816 0 3956 8816
+ *
+ * reads, reads merged, sectors read, ms reading, writes, writes merged,
+ * sectors written, ms writing, in flight, ms doing io, weighted ms, and
+ * discard and flush fields on newer kernels
+ */
+int32_t DiskStatsReader::read() {
+  ssize_t size = readFile(_path, _fd, _buf, DISK_STATS_MAX_BUFSIZE);
+  if (size < 0) {
+    return -1;
+  }
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  float ms = _lastReadMs != 0 && nowMs > _lastReadMs ?
+             (float) (nowMs - _lastReadMs) : 0.0f;
+  _stats.clear();
+  for (auto &device : _devices) {
+    device.seen = false;
+  }
+
+  size_t hint = 0;
+  const char *p = _buf.data();
+  const char *end = p + size;
+  while (p < end) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    uint64_t major, minor;
+    const char *cp = line;
+    if (!scanU64(cp, eol, &major) || !scanU64(cp, eol, &minor)) {
+      continue;
+    }
+    const char *name = skipSpaces(cp, eol);
+    cp = name;
+    while (cp < eol && *cp != ' ') ++cp;
+    const char *nameEnd = cp;
+
+    uint64_t fields[11];
+    int count = 0;
+    while (count < 11 && scanU64(cp, eol, &fields[count])) ++count;
+    if (count < 11) {
+      continue;
+    }
+    uint64_t counters[COUNTER_COUNT] = {
+      fields[0], fields[2], fields[3], fields[4], fields[6], fields[7],
+      fields[8], fields[9], fields[10]
+    };
+
+    Device *device = this->findDevice((uint32_t) major, (uint32_t) minor,
+                                      hint);
+    if (!device) {
+      _devices.emplace_back();
+      device = &_devices.back();
+      device->major = (uint32_t) major;
+      device->minor = (uint32_t) minor;
+      device->name.assign(name, nameEnd);
+      device->partition = this->isPartition(device->major, device->minor);
+      memcpy(device->counters, counters, sizeof(counters));
+      device->seen = true;
+      hint = _devices.size();
+      continue;
+    }
+    hint = device - _devices.data() + 1;
+    device->seen = true;
+    if (ms > 0 && (_partitions || !device->partition)) {
+      this->updateStat(*device, counters, ms);
+    }
+    memcpy(device->counters, counters, sizeof(counters));
+  }
+
+  // removed devices
+  _devices.erase(std::remove_if(_devices.begin(), _devices.end(),
+                                [](const Device &device) {
+                                  return !device.seen;
+                                }), _devices.end());
+  _lastReadMs = nowMs;
+  return 0;
+}
+
+YODA_NS_END
@@ -0,0 +1,80 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_DISK_STATS_H
+#define YODA_SIXSIX_DISK_STATS_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Rates of one block device between two reads of /proc/diskstats.
+ */
+struct DiskIOStat {
+  std::string device;
+  float readIops;
+  float writeIops;
+  float readBytes;
+  float writeBytes;
+  float readAwait;
+  float writeAwait;
+  float util;
+  float queueDepth;
+  uint32_t inFlight;
+};
+
+/*
+ * Parses /proc/diskstats in place and keeps the counters of the previous
+ * read per device. Devices are matched by major:minor, in the order of the
+ * last read first, so a read allocates nothing once the devices are known.
+ */
+class DiskStatsReader {
+public:
+  DiskStatsReader(const std::string &sysroot, bool partitions);
+
+  ~DiskStatsReader();
+
+  /*
+   * read and parse the file, returns 0 on success
+   */
+  int32_t read();
+
+  /*
+   * devices with io since the read before the last one
+   */
+  const std::vector<DiskIOStat> &stats() const { return _stats; }
+
+private:
+  struct Device {
+    uint32_t major;
+    uint32_t minor;
+    std::string name;
+    bool partition;
+    bool seen;
+    // reads, read sectors, read ms, writes, write sectors, write ms,
+    // in flight, io ms, weighted io ms
+    uint64_t counters[9];
+  };
+
+  Device *findDevice(uint32_t major, uint32_t minor, size_t hint);
+
+  bool isPartition(uint32_t major, uint32_t minor) const;
+
+  void updateStat(const Device &device, const uint64_t *counters,
+                  float ms);
+
+  std::string _sysroot;
+  std::string _path;
+  bool _partitions;
+  int _fd;
+  std::vector<char> _buf;
+  std::vector<Device> _devices;
+  std::vector<DiskIOStat> _stats;
+  uint64_t _lastReadMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_DISK_STATS_H
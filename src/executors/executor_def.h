@@ -7,6 +7,10 @@
 
 #include "job_i_executor.h"
 
+YODA_NS_BEGIN
+class ProcessTable;
+YODA_NS_END
+
 struct ProcessSmapInfo {
   uint32_t pid = 0;
   std::string comm;
@@ -25,15 +29,21 @@ struct ProcessSmapInfo {
   uint64_t size = 0;
   uint64_t start = 0;
   char smap_mode[5] = {0};
-  std::map<std::string, std::shared_ptr<ProcessSmapInfo>> sections;
+  // reused from an earlier scan, the process showed no change since
+  bool cached = false;
 };
 
-struct ProcessTopInfo {
-  uint32_t pid = 0;
-  char state[4];
+struct ProcessIdentity {
+  uint64_t startTime = 0;
   std::string comm;
   std::string cmdline;
   std::string fullname;
+};
+
+struct ProcessTopInfo {
+  uint32_t pid = 0;
+  char state[4];
+  std::shared_ptr<const ProcessIdentity> identity;
   uint32_t ppid = 0;
   uint32_t pgid = 0;
   uint32_t sid = 0;
@@ -49,9 +59,33 @@ struct ProcessTopInfo {
   int32_t lastSeenOnCPU = 0;
   uint64_t ticksDelta = 0;
   float cpuUsagePercent = 0.0f;
+  uint64_t minFlt = 0;
+  uint64_t majFlt = 0;
+  // from /proc/<pid>/status, only read for processes on cpu in the tick
+  bool hasSwitches = false;
+  uint64_t nvcsw = 0;
+  uint64_t nivcsw = 0;
+  float minFltRate = 0.0f;
+  float majFltRate = 0.0f;
+  float nvcswRate = 0.0f;
+  float nivcswRate = 0.0f;
+  // from /proc/<pid>/schedstat, in ns
+  bool hasSchedStat = false;
+  uint64_t runTime = 0;
+  uint64_t waitTime = 0;
+  uint64_t timeslices = 0;
+  uint64_t runDelta = 0;
+  uint64_t waitDelta = 0;
+  uint64_t timeslicesDelta = 0;
+  // uv_hrtime of the tick the sample was read in, older than the last
+  // tick if the pid was skipped at the scan deadline
+  uint64_t sampleTime = 0;
 };
 
 struct SystemCPUInfo {
+  uint32_t cpu = 0;
+  // offline cpus have no sample, their percents are 0
+  bool online = true;
   uint64_t usr = 0;
   float usrPercent = 0.0f;
   uint64_t nic = 0;
@@ -72,14 +106,36 @@ struct SystemCPUInfo {
   float busyPercent = 0;
 };
 
+struct SystemCounters {
+  // per second
+  float ctxtRate = 0.0f;
+  float intrRate = 0.0f;
+  float softirqRate = 0.0f;
+  float forkRate = 0.0f;
+  uint32_t procsRunning = 0;
+  uint32_t procsBlocked = 0;
+};
+
 struct SystemCPUDetailInfo {
   std::shared_ptr<SystemCPUInfo> total;
+  // indexed by cpu id
   std::vector<std::shared_ptr<SystemCPUInfo>> cores;
+  SystemCounters counters;
 };
 
 struct SystemTopInfo {
   std::shared_ptr<SystemCPUDetailInfo> cpu;
-  std::map<int32_t, std::shared_ptr<ProcessTopInfo>> processes;
+  std::shared_ptr<const yoda::ProcessTable> processes;
+  uint32_t syscalls = 0;
+  size_t cachedFds = 0;
+  // whether the pids came from a scan of the proc dir
+  bool fullScan = true;
+  // processes exited since last tick, reported by the proc connector
+  uint32_t exited = 0;
+  // pids not sampled within the scan window
+  uint32_t skipped = 0;
+  // time since the last sample, 0 for the first one
+  float tickMs = 0.0f;
 };
 
 struct SystemMemoryInfo {
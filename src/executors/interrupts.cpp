@@ -0,0 +1,202 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "interrupts.h"
+#include "proc_scan.h"
+#include <algorithm>
+
+#define INTERRUPTS_BUFSIZE (16 * 1024)
+// many-core hosts have wide rows, one per irq
+#define INTERRUPTS_MAX_BUFSIZE (4 * 1024 * 1024)
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+InterruptReader::InterruptReader(const std::string &path) :
+  _path(path),
+  _fd(-1),
+  _buf(INTERRUPTS_BUFSIZE),
+  _cpus(),
+  _rows(),
+  _counts(),
+  _deltas(),
+  _lastReadMs(0),
+  _intervalMs(0.0f) {
+
+}
+
+InterruptReader::~InterruptReader() {
+  if (_fd >= 0) {
+    close(_fd);
+  }
+}
+
+/*
+ *            CPU0       CPU1       CPU3
+ * returns true if the cpus changed, e.g. one went offline
+ */
+bool InterruptReader::parseHeader(const char *p, const char *end) {
+  size_t column = 0;
+  bool changed = false;
+  while (true) {
+    p = skipSpaces(p, end);
+    if (end - p < 3 || memcmp(p, "CPU", 3) != 0) {
+      break;
+    }
+    p += 3;
+    uint64_t cpu;
+    if (!scanU64(p, end, &cpu)) {
+      break;
+    }
+    if (column == _cpus.size()) {
+      _cpus.push_back((uint32_t) cpu);
+      changed = true;
+    } else if (_cpus[column] != cpu) {
+      _cpus[column] = (uint32_t) cpu;
+      changed = true;
+    }
+    ++column;
+  }
+  if (column != _cpus.size()) {
+    _cpus.resize(column);
+    changed = true;
+  }
+  return changed;
+}
+
+size_t InterruptReader::findRow(const char *name, size_t len, size_t hint) {
+  auto matches = [name, len](const Row &row) {
+    return row.name.size() == len && memcmp(row.name.data(), name, len) == 0;
+  };
+  if (hint < _rows.size() && matches(_rows[hint])) {
+    return hint;
+  }
+  for (size_t i = 0; i < _rows.size(); ++i) {
+    if (matches(_rows[i])) {
+      return i;
+    }
+  }
+  return _rows.size();
+}
+
+void InterruptReader::removeUnseen() {
+  size_t columns = _cpus.size();
+  size_t kept = 0;
+  for (size_t i = 0; i < _rows.size(); ++i) {
+    if (!_rows[i].seen) {
+      continue;
+    }
+    if (kept != i) {
+      _rows[kept] = std::move(_rows[i]);
+      std::copy(_counts.begin() + i * columns,
+                _counts.begin() + (i + 1) * columns,
+                _counts.begin() + kept * columns);
+      std::copy(_deltas.begin() + i * columns,
+                _deltas.begin() + (i + 1) * columns,
+                _deltas.begin() + kept * columns);
+    }
+    ++kept;
+  }
+  _rows.resize(kept);
+  _counts.resize(kept * columns);
+  _deltas.resize(kept * columns);
+}
+
+int32_t InterruptReader::read() {
+  ssize_t size = readFile(_path, _fd, _buf, INTERRUPTS_MAX_BUFSIZE);
+  if (size <= 0) {
+    return -1;
+  }
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  const char *p = _buf.data();
+  const char *end = p + size;
+  const char *eol = nextLine(p, end);
+  bool hasLast = _lastReadMs != 0;
+  if (this->parseHeader(p, eol)) {
+    // the columns moved, start over
+    _rows.clear();
+    _counts.clear();
+    _deltas.clear();
+    hasLast = false;
+  }
+  size_t columns = _cpus.size();
+  if (columns == 0) {
+    return -1;
+  }
+  p = eol;
+  for (auto &row : _rows) {
+    row.seen = false;
+  }
+  size_t hint = 0;
+  while (p < end) {
+    eol = nextLine(p, end);
+    const char *name = skipSpaces(p, eol);
+    const char *colon = (const char *) memchr(name, ':', eol - name);
+    p = eol;
+    if (!colon) {
+      continue;
+    }
+    size_t index = this->findRow(name, colon - name, hint);
+    bool added = index == _rows.size();
+    if (added) {
+      _rows.push_back({std::string(name, colon - name), "", false, 0});
+      _counts.resize(_counts.size() + columns);
+      _deltas.resize(_deltas.size() + columns);
+    }
+    auto &row = _rows[index];
+    row.seen = true;
+    row.totalDelta = 0;
+    uint64_t *counts = &_counts[index * columns];
+    uint64_t *deltas = &_deltas[index * columns];
+    const char *cp = colon + 1;
+    // ERR and MIS have one column only
+    for (size_t column = 0; column < columns; ++column) {
+      uint64_t count;
+      if (!scanU64(cp, eol, &count)) {
+        break;
+      }
+      uint64_t delta = hasLast && !added && count >= counts[column] ?
+                       count - counts[column] : 0;
+      counts[column] = count;
+      deltas[column] = delta;
+      row.totalDelta += delta;
+    }
+    if (added) {
+      // IO-APIC   5-edge      ACPI:Ged
+      const char *desc = skipSpaces(cp, eol);
+      const char *descEnd = eol;
+      while (descEnd > desc && (descEnd[-1] == '\n' || descEnd[-1] == ' ')) {
+        --descEnd;
+      }
+      row.desc.assign(desc, descEnd);
+    }
+    hint = index + 1;
+  }
+  // an irq is gone after its driver freed it
+  if (std::any_of(_rows.begin(), _rows.end(),
+                  [](const Row &row) { return !row.seen; })) {
+    this->removeUnseen();
+  }
+  _intervalMs = hasLast ? (float) (nowMs - _lastReadMs) : 0.0f;
+  _lastReadMs = nowMs;
+  return 0;
+}
+
+void InterruptReader::top(size_t count, std::vector<size_t> &rows) const {
+  rows.clear();
+  for (size_t i = 0; i < _rows.size(); ++i) {
+    if (_rows[i].totalDelta > 0) {
+      rows.push_back(i);
+    }
+  }
+  count = std::min(count, rows.size());
+  std::partial_sort(rows.begin(), rows.begin() + count, rows.end(),
+                    [this](size_t a, size_t b) {
+                      return _rows[a].totalDelta > _rows[b].totalDelta;
+                    });
+  rows.resize(count);
+}
+
+YODA_NS_END
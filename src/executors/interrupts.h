@@ -0,0 +1,84 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_INTERRUPTS_H
+#define YODA_SIXSIX_INTERRUPTS_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Per cpu counters of /proc/interrupts or /proc/softirqs, which share one
+ * layout: a header of the online cpus, then a row per irq. The counters
+ * and their deltas live in flat row-major matrices of rows x cpus that are
+ * reused every read. A row is matched by name, in the order of the last
+ * read, and only a new row makes strings.
+ */
+class InterruptReader {
+public:
+  explicit InterruptReader(const std::string &path);
+
+  ~InterruptReader();
+
+  /*
+   * read and parse the counters, returns 0 on success
+   */
+  int32_t read();
+
+  size_t rows() const { return _rows.size(); }
+
+  /*
+   * cpu ids of the columns, offline cpus are not listed
+   */
+  const std::vector<uint32_t> &cpus() const { return _cpus; }
+
+  const std::string &name(size_t row) const { return _rows[row].name; }
+
+  const std::string &desc(size_t row) const { return _rows[row].desc; }
+
+  uint64_t delta(size_t row, size_t column) const {
+    return _deltas[row * _cpus.size() + column];
+  }
+
+  uint64_t totalDelta(size_t row) const { return _rows[row].totalDelta; }
+
+  /*
+   * milliseconds between the last two reads, 0 after the first one
+   */
+  float intervalMs() const { return _intervalMs; }
+
+  /*
+   * rows of the count largest total deltas, largest first
+   */
+  void top(size_t count, std::vector<size_t> &rows) const;
+
+private:
+  struct Row {
+    std::string name;
+    std::string desc;
+    bool seen;
+    uint64_t totalDelta;
+  };
+
+  bool parseHeader(const char *p, const char *end);
+
+  size_t findRow(const char *name, size_t len, size_t hint);
+
+  void removeUnseen();
+
+  std::string _path;
+  int _fd;
+  std::vector<char> _buf;
+  std::vector<uint32_t> _cpus;
+  std::vector<Row> _rows;
+  std::vector<uint64_t> _counts;
+  std::vector<uint64_t> _deltas;
+  uint64_t _lastReadMs;
+  float _intervalMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_INTERRUPTS_H
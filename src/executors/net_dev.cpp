@@ -0,0 +1,241 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "net_dev.h"
+#include "proc_scan.h"
+#include "util.h"
+#include <algorithm>
+#include <fcntl.h>
+
+#define NET_DEV_BUFSIZE (4 * 1024)
+#define NET_DEV_MAX_BUFSIZE (256 * 1024)
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+static const char *statisticsFiles[] = {
+  "rx_bytes", "rx_packets", "rx_errors", "rx_dropped",
+  "tx_bytes", "tx_packets", "tx_errors", "tx_dropped"
+};
+
+NetDevReader::NetDevReader(const std::string &sysroot) :
+  _procPath(sysroot + "/proc/net/dev"),
+  _sysfsDir(sysroot + "/sys/class/net/"),
+  _fd(-1),
+  _useSysfs(false),
+  _buf(NET_DEV_BUFSIZE),
+  _interfaces(),
+  _rates(),
+  _lastReadMs(0) {
+
+}
+
+NetDevReader::~NetDevReader() {
+  if (_fd >= 0) {
+    close(_fd);
+  }
+  for (auto &interface : _interfaces) {
+    for (auto fd : interface.fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+}
+
+NetDevReader::Interface *NetDevReader::findInterface(const char *name,
+                                                     size_t len,
+                                                     size_t hint) {
+  if (hint < _interfaces.size()) {
+    auto &interface = _interfaces[hint];
+    if (interface.name.size() == len &&
+        memcmp(interface.name.data(), name, len) == 0) {
+      return &interface;
+    }
+  }
+  for (auto &interface : _interfaces) {
+    if (interface.name.size() == len &&
+        memcmp(interface.name.data(), name, len) == 0) {
+      return &interface;
+    }
+  }
+  return nullptr;
+}
+
+NetDevReader::Interface *NetDevReader::addInterface(const char *name,
+                                                    size_t len) {
+  _interfaces.emplace_back();
+  auto &interface = _interfaces.back();
+  interface.name.assign(name, len);
+  memset(interface.counters, 0, sizeof(interface.counters));
+  for (auto &fd : interface.fds) {
+    fd = -1;
+  }
+  return &interface;
+}
+
+void NetDevReader::update(Interface &interface, const uint64_t *counters,
+                          float ms) {
+  uint64_t delta[COUNTER_COUNT];
+  bool changed = false;
+  for (int i = 0; i < COUNTER_COUNT; ++i) {
+    // counters restart if the driver is reloaded
+    delta[i] = counters[i] >= interface.counters[i] ?
+               counters[i] - interface.counters[i] : 0;
+    changed = changed || delta[i] != 0;
+    interface.counters[i] = counters[i];
+  }
+  if (ms <= 0 || !changed) {
+    return;
+  }
+  _rates.emplace_back();
+  auto &rate = _rates.back();
+  rate.interface = interface.name;
+  float perSecond = 1000.0f / ms;
+  rate.rxBytes = delta[RX_BYTES] * perSecond;
+  rate.rxPackets = delta[RX_PACKETS] * perSecond;
+  rate.rxErrors = delta[RX_ERRORS] * perSecond;
+  rate.rxDrops = delta[RX_DROPS] * perSecond;
+  rate.txBytes = delta[TX_BYTES] * perSecond;
+  rate.txPackets = delta[TX_PACKETS] * perSecond;
+  rate.txErrors = delta[TX_ERRORS] * perSecond;
+  rate.txDrops = delta[TX_DROPS] * perSecond;
+}
+
+int32_t NetDevReader::read() {
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  float ms = _lastReadMs != 0 && nowMs > _lastReadMs ?
+             (float) (nowMs - _lastReadMs) : 0.0f;
+  _rates.clear();
+  for (auto &interface : _interfaces) {
+    interface.seen = false;
+  }
+
+  int32_t r = 0;
+  if (!_useSysfs) {
+    r = this->readProc(ms);
+    if (r != 0 && _fd < 0) {
+      LOG_INFO("%s is not readable, read %s instead",
+               _procPath.c_str(), _sysfsDir.c_str());
+      _useSysfs = true;
+    }
+  }
+  if (_useSysfs) {
+    r = this->readSysfs(ms);
+  }
+
+  // removed interfaces
+  for (auto &interface : _interfaces) {
+    if (interface.seen) {
+      continue;
+    }
+    for (auto &fd : interface.fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+  _interfaces.erase(std::remove_if(_interfaces.begin(), _interfaces.end(),
+                                   [](const Interface &interface) {
+                                     return !interface.seen;
+                                   }), _interfaces.end());
+  _lastReadMs = nowMs;
+  return r;
+}
+
+/*
+ * Inter-|   Receive                            ...|  Transmit
+ *  face |bytes    packets errs drop fifo frame ...|bytes    packets ...
+ *   eth0:  1062      17    0    0    0     0   ...   1230      17 ...
+ *
+ * 8 receive fields: bytes packets errs drop fifo frame compressed multicast
+ * 8 transmit fields: bytes packets errs drop fifo colls carrier compressed
+ */
+int32_t NetDevReader::readProc(float ms) {
+  ssize_t size = readFile(_procPath, _fd, _buf, NET_DEV_MAX_BUFSIZE);
+  if (size < 0) {
+    return -1;
+  }
+  size_t hint = 0;
+  const char *p = _buf.data();
+  const char *end = p + size;
+  while (p < end) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    const char *colon = (const char *) memchr(line, ':', eol - line);
+    if (!colon) {
+      continue;
+    }
+    const char *name = skipSpaces(line, colon);
+    size_t len = colon - name;
+
+    uint64_t fields[16];
+    const char *cp = colon + 1;
+    int count = 0;
+    while (count < 16 && scanU64(cp, eol, &fields[count])) ++count;
+    if (count < 16) {
+      continue;
+    }
+    uint64_t counters[COUNTER_COUNT] = {
+      fields[0], fields[1], fields[2], fields[3],
+      fields[8], fields[9], fields[10], fields[11]
+    };
+
+    Interface *interface = this->findInterface(name, len, hint);
+    if (!interface) {
+      interface = this->addInterface(name, len);
+      memcpy(interface->counters, counters, sizeof(counters));
+    } else {
+      this->update(*interface, counters, ms);
+    }
+    interface->seen = true;
+    hint = interface - _interfaces.data() + 1;
+  }
+  return 0;
+}
+
+int32_t NetDevReader::readSysfs(float ms) {
+  // the fallback lists the interfaces every read, they come and go
+  auto names = Util::getFileList(_sysfsDir);
+  if (names.empty()) {
+    return -1;
+  }
+  char value[32];
+  for (auto &name : names) {
+    Interface *interface = this->findInterface(name.data(), name.size(),
+                                               _interfaces.size());
+    bool added = false;
+    if (!interface) {
+      interface = this->addInterface(name.data(), name.size());
+      added = true;
+    }
+    interface->seen = true;
+    uint64_t counters[COUNTER_COUNT] = {};
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+      int &fd = interface->fds[i];
+      if (fd < 0) {
+        auto path = _sysfsDir + name + "/statistics/" + statisticsFiles[i];
+        fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+          continue;
+        }
+      }
+      ssize_t size = pread(fd, value, sizeof(value), 0);
+      const char *cp = value;
+      if (size > 0) {
+        scanU64(cp, value + size, &counters[i]);
+      }
+    }
+    if (added) {
+      memcpy(interface->counters, counters, sizeof(counters));
+    } else {
+      this->update(*interface, counters, ms);
+    }
+  }
+  return 0;
+}
+
+YODA_NS_END
@@ -0,0 +1,93 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_NET_DEV_H
+#define YODA_SIXSIX_NET_DEV_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Per second traffic of one interface between two reads.
+ */
+struct NetDevRate {
+  std::string interface;
+  float rxBytes;
+  float rxPackets;
+  float rxErrors;
+  float rxDrops;
+  float txBytes;
+  float txPackets;
+  float txErrors;
+  float txDrops;
+};
+
+/*
+ * Reads the interface counters from /proc/net/dev, or from
+ * /sys/class/net/<interface>/statistics if /proc/net/dev can not be read.
+ * Lines are parsed in place from one reused buffer and matched against the
+ * known interfaces in the order of the last read, a new std::string is only
+ * made for a new interface.
+ */
+class NetDevReader {
+public:
+  explicit NetDevReader(const std::string &sysroot);
+
+  ~NetDevReader();
+
+  /*
+   * read and parse the counters, returns 0 on success
+   */
+  int32_t read();
+
+  /*
+   * interfaces with traffic since the read before the last one
+   */
+  const std::vector<NetDevRate> &rates() const { return _rates; }
+
+private:
+  enum {
+    RX_BYTES = 0,
+    RX_PACKETS,
+    RX_ERRORS,
+    RX_DROPS,
+    TX_BYTES,
+    TX_PACKETS,
+    TX_ERRORS,
+    TX_DROPS,
+    COUNTER_COUNT
+  };
+
+  struct Interface {
+    std::string name;
+    bool seen;
+    uint64_t counters[COUNTER_COUNT];
+    // fds of the sysfs statistics files
+    int fds[COUNTER_COUNT];
+  };
+
+  int32_t readProc(float ms);
+
+  int32_t readSysfs(float ms);
+
+  Interface *findInterface(const char *name, size_t len, size_t hint);
+
+  Interface *addInterface(const char *name, size_t len);
+
+  void update(Interface &interface, const uint64_t *counters, float ms);
+
+  std::string _procPath;
+  std::string _sysfsDir;
+  int _fd;
+  bool _useSysfs;
+  std::vector<char> _buf;
+  std::vector<Interface> _interfaces;
+  std::vector<NetDevRate> _rates;
+  uint64_t _lastReadMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_NET_DEV_H
@@ -0,0 +1,110 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "pid_enumerator.h"
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/syscall.h>
+
+#define DIRENT_BUFSIZE (32 * 1024)
+
+namespace {
+
+struct linux_dirent64 {
+  uint64_t d_ino;
+  int64_t d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[];
+};
+
+/*
+ * pids are at most 7 digits (PID_MAX_LIMIT is 4M), anything longer or
+ * with a non digit char is not a pid
+ */
+inline bool parsePid(const char *name, uint32_t *pid) {
+  uint32_t value = 0;
+  uint32_t invalid = 0;
+  const char *p = name;
+  for (; *p; ++p) {
+    uint32_t digit = (uint32_t) (unsigned char) *p - '0';
+    invalid |= digit > 9;
+    value = value * 10 + digit;
+  }
+  size_t len = p - name;
+  *pid = value;
+  return !(invalid | (len == 0) | (len > 7));
+}
+
+}
+
+YODA_NS_BEGIN
+
+PidEnumerator::PidEnumerator() : _fd(-1),
+                                 _buf(nullptr),
+                                 _bufSize(DIRENT_BUFSIZE),
+                                 _pos(0),
+                                 _end(0) {
+  _buf = (char *) malloc(_bufSize);
+  ASSERT(_buf, "alloc dirent buffer failed");
+}
+
+PidEnumerator::~PidEnumerator() {
+  this->close();
+  YODA_SIXSIX_SAFE_FREE(_buf);
+}
+
+bool PidEnumerator::open(const std::string &procDir) {
+  this->close();
+  _fd = ::open(procDir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  return _fd >= 0;
+}
+
+void PidEnumerator::close() {
+  if (_fd >= 0) {
+    ::close(_fd);
+    _fd = -1;
+  }
+  _pos = 0;
+  _end = 0;
+}
+
+bool PidEnumerator::fill() {
+  long r = syscall(SYS_getdents64, _fd, _buf, _bufSize);
+  if (r <= 0) {
+    return false;
+  }
+  _pos = 0;
+  _end = (size_t) r;
+  return true;
+}
+
+bool PidEnumerator::next(uint32_t *pid) {
+  if (_fd < 0) {
+    return false;
+  }
+  while (true) {
+    if (_pos >= _end && !this->fill()) {
+      return false;
+    }
+    auto ent = (linux_dirent64 *) (_buf + _pos);
+    _pos += ent->d_reclen;
+    if (!parsePid(ent->d_name, pid)) {
+      continue;
+    }
+    if (ent->d_type == DT_DIR) {
+      return true;
+    }
+    if (ent->d_type == DT_UNKNOWN) {
+      // file systems without d_type support, e.g. some sysroot mounts
+      struct stat st = {};
+      if (fstatat(_fd, ent->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0 &&
+          S_ISDIR(st.st_mode)) {
+        return true;
+      }
+    }
+  }
+}
+
+YODA_NS_END
@@ -0,0 +1,47 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PID_ENUMERATOR_H
+#define YODA_SIXSIX_PID_ENUMERATOR_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Lists the pid directories of a proc dir with getdents64 into a buffer
+ * owned by the enumerator, no allocation is made per entry.
+ */
+class PidEnumerator {
+public:
+  PidEnumerator();
+
+  ~PidEnumerator();
+
+  PidEnumerator(const PidEnumerator &) = delete;
+
+  PidEnumerator &operator=(const PidEnumerator &) = delete;
+
+  bool open(const std::string &procDir);
+
+  /*
+   * returns false if there is no more pid or the dir is not opened
+   */
+  bool next(uint32_t *pid);
+
+  void close();
+
+private:
+  bool fill();
+
+  int _fd;
+  char *_buf;
+  size_t _bufSize;
+  size_t _pos;
+  size_t _end;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PID_ENUMERATOR_H
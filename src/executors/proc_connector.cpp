@@ -0,0 +1,233 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_connector.h"
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/connector.h>
+#include <linux/cn_proc.h>
+
+// bound the exit records kept between two ticks during fork storms
+#define MAX_EXIT_RECORDS 256
+#define NL_RECV_BUFSIZE 4096
+
+YODA_NS_BEGIN
+
+ProcConnector::ProcConnector(const std::string &procDir) :
+  _procDir(procDir),
+  _fd(-1),
+  _poll(nullptr),
+  _mutex(),
+  _overflowed(true),
+  _scanning(false),
+  _pids(),
+  _forkedInScan(),
+  _exits(),
+  _droppedExits(0) {
+
+}
+
+ProcConnector::~ProcConnector() {
+  this->stop();
+}
+
+int ProcConnector::start(uv_loop_t *loop) {
+  ASSERT(_fd < 0, "proc connector is running");
+  _fd = socket(PF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+               NETLINK_CONNECTOR);
+  if (_fd < 0) {
+    LOG_ERROR("proc connector socket error: %s", strerror(errno));
+    return -1;
+  }
+  sockaddr_nl addr = {};
+  addr.nl_family = AF_NETLINK;
+  addr.nl_groups = CN_IDX_PROC;
+  addr.nl_pid = 0;
+  if (bind(_fd, (sockaddr *) &addr, sizeof(addr)) != 0) {
+    LOG_ERROR("proc connector bind error: %s", strerror(errno));
+    this->stop();
+    return -1;
+  }
+
+  char buf[NLMSG_SPACE(sizeof(cn_msg) + sizeof(proc_cn_mcast_op))] = {0};
+  auto nlh = (nlmsghdr *) buf;
+  nlh->nlmsg_len = NLMSG_LENGTH(sizeof(cn_msg) + sizeof(proc_cn_mcast_op));
+  nlh->nlmsg_type = NLMSG_DONE;
+  nlh->nlmsg_pid = getpid();
+  auto msg = (cn_msg *) NLMSG_DATA(nlh);
+  msg->id.idx = CN_IDX_PROC;
+  msg->id.val = CN_VAL_PROC;
+  msg->len = sizeof(proc_cn_mcast_op);
+  *(proc_cn_mcast_op *) msg->data = PROC_CN_MCAST_LISTEN;
+  if (send(_fd, nlh, nlh->nlmsg_len, 0) < 0) {
+    LOG_ERROR("proc connector listen error: %s", strerror(errno));
+    this->stop();
+    return -1;
+  }
+
+  _poll = new uv_poll_t;
+  uv_poll_init(loop, _poll, _fd);
+  UV_CB_WRAP3(_poll, cb, ProcConnector, onPoll, uv_poll_t, int, int);
+  uv_poll_start(_poll, UV_READABLE, cb);
+  LOG_INFO("proc connector started");
+  return 0;
+}
+
+void ProcConnector::stop() {
+  if (_poll) {
+    // the connector may be gone before the close callback
+    _poll->data = nullptr;
+    uv_close((uv_handle_t *) _poll, [](uv_handle_t *handle) {
+      delete (uv_poll_t *) handle;
+    });
+    _poll = nullptr;
+  }
+  if (_fd >= 0) {
+    close(_fd);
+    _fd = -1;
+  }
+  std::lock_guard<std::mutex> lock(_mutex);
+  _overflowed = true;
+}
+
+bool ProcConnector::isRunning() {
+  return _fd >= 0;
+}
+
+void ProcConnector::onPoll(uv_poll_t *, int status, int) {
+  if (status < 0) {
+    LOG_ERROR("proc connector poll error: %s", uv_strerror(status));
+    return;
+  }
+  char buf[NL_RECV_BUFSIZE] __attribute__((aligned(NLMSG_ALIGNTO)));
+  while (true) {
+    ssize_t len = recv(_fd, buf, sizeof(buf), 0);
+    if (len < 0) {
+      if (errno == ENOBUFS) {
+        // socket buffer overrun, events are lost
+        LOG_ERROR("proc connector events overflowed");
+        std::lock_guard<std::mutex> lock(_mutex);
+        _overflowed = true;
+        continue;
+      }
+      break;
+    }
+    if (len == 0) {
+      break;
+    }
+    auto remaining = (int) len;
+    for (auto nlh = (nlmsghdr *) buf; NLMSG_OK(nlh, remaining);
+         nlh = NLMSG_NEXT(nlh, remaining)) {
+      if (nlh->nlmsg_type == NLMSG_NOOP || nlh->nlmsg_type == NLMSG_ERROR) {
+        continue;
+      }
+      auto msg = (cn_msg *) NLMSG_DATA(nlh);
+      if (msg->id.idx != CN_IDX_PROC || msg->id.val != CN_VAL_PROC) {
+        continue;
+      }
+      auto ev = (proc_event *) msg->data;
+      switch (ev->what) {
+        case proc_event::PROC_EVENT_FORK: {
+          auto &forked = ev->event_data.fork;
+          // threads are not listed in /proc
+          if (forked.child_pid != forked.child_tgid) {
+            break;
+          }
+          std::lock_guard<std::mutex> lock(_mutex);
+          _pids.insert((uint32_t) forked.child_tgid);
+          if (_scanning) {
+            _forkedInScan.push_back((uint32_t) forked.child_tgid);
+          }
+          break;
+        }
+        case proc_event::PROC_EVENT_EXEC: {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _pids.insert((uint32_t) ev->event_data.exec.process_tgid);
+          break;
+        }
+        case proc_event::PROC_EVENT_EXIT: {
+          auto &exited = ev->event_data.exit;
+          if (exited.process_pid == exited.process_tgid) {
+            this->onExit((uint32_t) exited.process_tgid);
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+}
+
+void ProcConnector::onExit(uint32_t pid) {
+  // the exit event carries no cpu time, read the final ticks before the
+  // parent reaps it. The pid is left in the live set, the sampler drops
+  // it once the stat file is gone, as a leader may exit before its
+  // threads.
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_exits.size() >= MAX_EXIT_RECORDS) {
+      ++_droppedExits;
+      return;
+    }
+  }
+  ExitRecord record = {};
+  record.pid = pid;
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/%u/stat", _procDir.c_str(), pid);
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+  ssize_t r = read(fd, record.stat, sizeof(record.stat) - 1);
+  close(fd);
+  if (r <= 0) {
+    return;
+  }
+  record.stat[r] = '\0';
+  std::lock_guard<std::mutex> lock(_mutex);
+  _exits.push_back(record);
+}
+
+bool ProcConnector::snapshot(std::vector<uint32_t> &pids) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_overflowed) {
+    return false;
+  }
+  pids.assign(_pids.begin(), _pids.end());
+  return true;
+}
+
+void ProcConnector::beginScan() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _scanning = true;
+  _forkedInScan.clear();
+}
+
+void ProcConnector::endScan(const std::vector<uint32_t> &pids) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _pids.clear();
+  _pids.insert(pids.begin(), pids.end());
+  _pids.insert(_forkedInScan.begin(), _forkedInScan.end());
+  _forkedInScan.clear();
+  _scanning = false;
+  _overflowed = _fd < 0;
+}
+
+void ProcConnector::remove(uint32_t pid) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _pids.erase(pid);
+}
+
+void ProcConnector::drainExits(std::vector<ExitRecord> &records,
+                               uint32_t *dropped) {
+  records.clear();
+  std::lock_guard<std::mutex> lock(_mutex);
+  records.swap(_exits);
+  *dropped = _droppedExits;
+  _droppedExits = 0;
+}
+
+YODA_NS_END
@@ -0,0 +1,81 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_CONNECTOR_H
+#define YODA_SIXSIX_PROC_CONNECTOR_H
+
+#include "def.h"
+#include <mutex>
+#include <unordered_set>
+
+#define PROC_EXIT_STAT_SIZE 512
+
+YODA_NS_BEGIN
+
+/*
+ * Listens to fork/exec/exit events of the netlink proc connector on the
+ * uv loop and keeps the live pid set, so the sampler does not need to
+ * list /proc every tick. Needs CAP_NET_ADMIN.
+ *
+ * All methods but start/stop are called from the sampler thread.
+ */
+class ProcConnector {
+public:
+  struct ExitRecord {
+    uint32_t pid;
+    // /proc/<pid>/stat read when the exit event arrived
+    char stat[PROC_EXIT_STAT_SIZE];
+  };
+
+  explicit ProcConnector(const std::string &procDir);
+
+  ~ProcConnector();
+
+  int start(uv_loop_t *loop);
+
+  void stop();
+
+  bool isRunning();
+
+  /*
+   * copy the live pids, returns false if events were lost and a full
+   * scan is needed
+   */
+  bool snapshot(std::vector<uint32_t> &pids);
+
+  /*
+   * a full scan replaces the live pids, pids forked in between
+   * beginScan and endScan are kept
+   */
+  void beginScan();
+
+  void endScan(const std::vector<uint32_t> &pids);
+
+  void remove(uint32_t pid);
+
+  /*
+   * move the exit records since last call into records
+   */
+  void drainExits(std::vector<ExitRecord> &records, uint32_t *dropped);
+
+private:
+  void onPoll(uv_poll_t *handle, int status, int events);
+
+  void onExit(uint32_t pid);
+
+  std::string _procDir;
+  int _fd;
+  uv_poll_t *_poll;
+  std::mutex _mutex;
+  bool _overflowed;
+  bool _scanning;
+  std::unordered_set<uint32_t> _pids;
+  std::vector<uint32_t> _forkedInScan;
+  std::vector<ExitRecord> _exits;
+  uint32_t _droppedExits;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_CONNECTOR_H
@@ -0,0 +1,165 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_fd_cache.h"
+#include <fcntl.h>
+
+YODA_NS_BEGIN
+
+static const char *procFileNames[] = {
+  "stat",
+  "status",
+  "schedstat",
+};
+
+ProcFdCache::ProcFdCache(const std::string &procDir) : _procDir(procDir),
+                                                       _persistent(false),
+                                                       _tick(0),
+                                                       _syscalls(0),
+                                                       _maxFds(0),
+                                                       _openFds(0),
+                                                       _entries() {
+  // leave half of the fd limit to the websocket, curl and child processes
+  rlimit limit = {};
+  if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY) {
+    _maxFds = limit.rlim_cur / 2;
+  } else {
+    _maxFds = 512;
+  }
+}
+
+ProcFdCache::~ProcFdCache() {
+  this->setPersistent(false);
+}
+
+void ProcFdCache::setPersistent(bool persistent) {
+  _persistent = persistent;
+  if (!persistent) {
+    for (auto &pair : _entries) {
+      this->closeEntry(pair.second);
+    }
+    _entries.clear();
+  }
+}
+
+int ProcFdCache::openFile(uint32_t pid, const char *name) {
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/%u/%s", _procDir.c_str(), pid, name);
+  ++_syscalls;
+  return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+ssize_t ProcFdCache::readOnce(uint32_t pid, const char *name, char *buf,
+                              size_t size) {
+  int fd = this->openFile(pid, name);
+  if (fd < 0) {
+    return -1;
+  }
+  _syscalls += 2;
+  ssize_t r = ::read(fd, buf, size - 1);
+  close(fd);
+  if (r < 0) {
+    return -1;
+  }
+  buf[r] = '\0';
+  return r;
+}
+
+ssize_t ProcFdCache::read(uint32_t pid, ProcFile file, char *buf,
+                          size_t size) {
+  auto idx = (uint32_t) file;
+  if (!_persistent) {
+    return this->readOnce(pid, procFileNames[idx], buf, size);
+  }
+  // a pid which failed with ESRCH may already belong to a new process,
+  // retry once with a fresh fd
+  for (int32_t retry = 0; retry < 2; ++retry) {
+    auto ite = _entries.find(pid);
+    if (ite == _entries.end()) {
+      if (_openFds >= _maxFds) {
+        return this->readOnce(pid, procFileNames[idx], buf, size);
+      }
+      Entry entry = {};
+      for (auto &fd : entry.fds) {
+        fd = -1;
+      }
+      ite = _entries.insert({pid, entry}).first;
+    }
+    Entry &entry = ite->second;
+    entry.tick = _tick;
+    if (entry.fds[idx] < 0) {
+      if (_openFds >= _maxFds) {
+        return this->readOnce(pid, procFileNames[idx], buf, size);
+      }
+      entry.fds[idx] = this->openFile(pid, procFileNames[idx]);
+      if (entry.fds[idx] < 0) {
+        this->closeEntry(entry);
+        _entries.erase(ite);
+        return -1;
+      }
+      ++_openFds;
+    }
+    ++_syscalls;
+    ssize_t r = pread(entry.fds[idx], buf, size - 1, 0);
+    if (r >= 0) {
+      buf[r] = '\0';
+      return r;
+    }
+    int err = errno;
+    this->closeEntry(entry);
+    _entries.erase(ite);
+    if (err != ESRCH) {
+      break;
+    }
+  }
+  return -1;
+}
+
+void ProcFdCache::bind(uint32_t pid, uint64_t startTime) {
+  auto ite = _entries.find(pid);
+  if (ite == _entries.end()) {
+    return;
+  }
+  Entry &entry = ite->second;
+  if (entry.startTime != 0 && entry.startTime != startTime) {
+    LOG_VERBOSE("pid %u reused, drop cached fds", pid);
+    this->closeEntry(entry);
+  }
+  entry.startTime = startTime;
+}
+
+void ProcFdCache::keep(uint32_t pid) {
+  auto ite = _entries.find(pid);
+  if (ite != _entries.end()) {
+    ite->second.tick = _tick;
+  }
+}
+
+uint32_t ProcFdCache::endTick() {
+  for (auto ite = _entries.begin(); ite != _entries.end();) {
+    if (ite->second.tick != _tick) {
+      this->closeEntry(ite->second);
+      ite = _entries.erase(ite);
+    } else {
+      ++ite;
+    }
+  }
+  ++_tick;
+  uint32_t syscalls = _syscalls;
+  _syscalls = 0;
+  return syscalls;
+}
+
+void ProcFdCache::closeEntry(Entry &entry) {
+  for (auto &fd : entry.fds) {
+    if (fd >= 0) {
+      ++_syscalls;
+      close(fd);
+      fd = -1;
+      --_openFds;
+    }
+  }
+}
+
+YODA_NS_END
@@ -0,0 +1,95 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_FD_CACHE_H
+#define YODA_SIXSIX_PROC_FD_CACHE_H
+
+#include "def.h"
+#include <unordered_map>
+
+YODA_NS_BEGIN
+
+enum class ProcFile : uint32_t {
+  STAT = 0,
+  STATUS,
+  SCHEDSTAT,
+  COUNT
+};
+
+/*
+ * Reads /proc/<pid>/<file> for the sampler. In persistent mode the opened
+ * fds are kept across ticks, keyed by (pid, starttime), and re-read with
+ * pread, otherwise every read is a plain open/read/close.
+ */
+class ProcFdCache {
+public:
+  explicit ProcFdCache(const std::string &procDir);
+
+  ~ProcFdCache();
+
+  void setPersistent(bool persistent);
+
+  bool isPersistent() const { return _persistent; }
+
+  /*
+   * read the file of pid into buf and terminate it with '\0',
+   * returns the read size or -1 if the process is gone
+   */
+  ssize_t read(uint32_t pid, ProcFile file, char *buf, size_t size);
+
+  /*
+   * read /proc/<pid>/<name> with open/read/close whatever the mode is,
+   * for files that are rarely read
+   */
+  ssize_t readOnce(uint32_t pid, const char *name, char *buf, size_t size);
+
+  /*
+   * bind the cached fds of pid to the process start time, fds opened by
+   * a previous owner of the pid are dropped
+   */
+  void bind(uint32_t pid, uint64_t startTime);
+
+  /*
+   * keep the fds of pid open through endTick without reading them
+   */
+  void keep(uint32_t pid);
+
+  /*
+   * close the fds of processes not read since last call,
+   * returns the syscall count of this tick
+   */
+  uint32_t endTick();
+
+  size_t openFds() const { return _openFds; }
+
+  size_t maxFds() const { return _maxFds; }
+
+  /*
+   * reads beyond the limit fall back to open/read/close
+   */
+  void setMaxFds(size_t maxFds) { _maxFds = maxFds; }
+
+private:
+  struct Entry {
+    uint64_t startTime;
+    uint32_t tick;
+    int fds[(uint32_t) ProcFile::COUNT];
+  };
+
+  int openFile(uint32_t pid, const char *name);
+
+  void closeEntry(Entry &entry);
+
+  std::string _procDir;
+  bool _persistent;
+  uint32_t _tick;
+  uint32_t _syscalls;
+  size_t _maxFds;
+  size_t _openFds;
+  std::unordered_map<uint32_t, Entry> _entries;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_FD_CACHE_H
@@ -0,0 +1,56 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_identity_cache.h"
+
+YODA_NS_BEGIN
+
+ProcIdentityCache::ProcIdentityCache() : _tick(0), _entries() {
+
+}
+
+std::shared_ptr<const ProcessIdentity>
+ProcIdentityCache::find(uint32_t pid, uint64_t startTime, const char *comm,
+                        size_t commLen) {
+  auto ite = _entries.find(pid);
+  if (ite == _entries.end()) {
+    return nullptr;
+  }
+  auto &identity = ite->second.identity;
+  if (identity->startTime != startTime ||
+      identity->comm.size() != commLen ||
+      memcmp(identity->comm.data(), comm, commLen) != 0) {
+    _entries.erase(ite);
+    return nullptr;
+  }
+  ite->second.tick = _tick;
+  return identity;
+}
+
+void ProcIdentityCache::insert(
+  uint32_t pid, const std::shared_ptr<const ProcessIdentity> &identity) {
+  Entry &entry = _entries[pid];
+  entry.tick = _tick;
+  entry.identity = identity;
+}
+
+void ProcIdentityCache::keep(uint32_t pid) {
+  auto ite = _entries.find(pid);
+  if (ite != _entries.end()) {
+    ite->second.tick = _tick;
+  }
+}
+
+void ProcIdentityCache::endTick() {
+  for (auto ite = _entries.begin(); ite != _entries.end();) {
+    if (ite->second.tick != _tick) {
+      ite = _entries.erase(ite);
+    } else {
+      ++ite;
+    }
+  }
+  ++_tick;
+}
+
+YODA_NS_END
@@ -0,0 +1,57 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_IDENTITY_CACHE_H
+#define YODA_SIXSIX_PROC_IDENTITY_CACHE_H
+
+#include "executor_def.h"
+#include <unordered_map>
+
+YODA_NS_BEGIN
+
+/*
+ * Names of the sampled processes keyed by (pid, starttime). An entry is
+ * reused as long as the comm in /proc/<pid>/stat is unchanged, exec
+ * renames the comm and forces the cmdline to be read again.
+ */
+class ProcIdentityCache {
+public:
+  ProcIdentityCache();
+
+  /*
+   * returns the cached identity, or nullptr if pid is reused or exec'ed
+   */
+  std::shared_ptr<const ProcessIdentity> find(uint32_t pid,
+                                              uint64_t startTime,
+                                              const char *comm,
+                                              size_t commLen);
+
+  void insert(uint32_t pid,
+              const std::shared_ptr<const ProcessIdentity> &identity);
+
+  /*
+   * keep the identity of pid through endTick without a lookup
+   */
+  void keep(uint32_t pid);
+
+  /*
+   * drop identities of processes not seen since last call
+   */
+  void endTick();
+
+  size_t size() const { return _entries.size(); }
+
+private:
+  struct Entry {
+    uint32_t tick;
+    std::shared_ptr<const ProcessIdentity> identity;
+  };
+
+  uint32_t _tick;
+  std::unordered_map<uint32_t, Entry> _entries;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_IDENTITY_CACHE_H
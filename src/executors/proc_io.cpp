@@ -0,0 +1,150 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_io.h"
+#include "proc_scan.h"
+#include "process_table.h"
+#include <algorithm>
+#include <fcntl.h>
+
+#define PROC_IO_BUFSIZE 512
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+ProcIOSampler::ProcIOSampler() : _entries(), _rows(), _rates() {
+
+}
+
+/*
+ * rchar: 3980
+ * wchar: 0
+ * syscr: 9
+ * syscw: 0
+ * read_bytes: 0
+ * write_bytes: 0
+ * cancelled_write_bytes: 0
+ */
+bool ProcIOSampler::readIO(const std::string &procDir, uint32_t pid,
+                           uint64_t *counters) {
+  char path[64];
+  snprintf(path, sizeof(path), "/%u/io", pid);
+  // readable by the owner or with CAP_SYS_PTRACE only
+  int fd = open((procDir + path).c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  char buf[PROC_IO_BUFSIZE];
+  ssize_t size = read(fd, buf, sizeof(buf));
+  close(fd);
+  if (size <= 0) {
+    return false;
+  }
+  // the order of the lines is fixed
+  uint64_t values[7];
+  int count = 0;
+  const char *p = buf;
+  const char *end = buf + size;
+  while (p < end && count < 7) {
+    const char *eol = nextLine(p, end);
+    const char *colon = (const char *) memchr(p, ':', eol - p);
+    p = eol;
+    if (!colon) {
+      continue;
+    }
+    const char *cp = colon + 1;
+    if (!scanU64(cp, eol, &values[count])) {
+      return false;
+    }
+    ++count;
+  }
+  if (count < 7) {
+    return false;
+  }
+  counters[SYSCR] = values[2];
+  counters[SYSCW] = values[3];
+  counters[READ_BYTES] = values[4];
+  counters[WRITE_BYTES] = values[5];
+  counters[CANCELLED_WRITE_BYTES] = values[6];
+  return true;
+}
+
+const std::vector<ProcIORate> &ProcIOSampler::sample(
+  const std::string &procDir,
+  const ProcessTable &table,
+  size_t count) {
+  _rates.clear();
+
+  // drop the entries of exited processes
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    int64_t row = table.find(it->first);
+    if (row < 0 || table.startTime((size_t) row) != it->second.startTime) {
+      it = _entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  _rows.clear();
+  for (size_t row = 0; row < table.size(); ++row) {
+    if (table.ticksDelta(row) > 0) {
+      _rows.push_back(row);
+    }
+  }
+  count = std::min(count, _rows.size());
+  std::partial_sort(_rows.begin(), _rows.begin() + count, _rows.end(),
+                    [&table](size_t a, size_t b) {
+                      return table.ticksDelta(a) > table.ticksDelta(b);
+                    });
+
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  for (size_t i = 0; i < count; ++i) {
+    size_t row = _rows[i];
+    uint32_t pid = table.pid(row);
+    uint64_t counters[COUNTER_COUNT];
+    if (!this->readIO(procDir, pid, counters)) {
+      continue;
+    }
+    auto it = _entries.find(pid);
+    if (it == _entries.end()) {
+      auto &entry = _entries[pid];
+      entry.startTime = table.startTime(row);
+      entry.readMs = nowMs;
+      memcpy(entry.counters, counters, sizeof(counters));
+      continue;
+    }
+    auto &entry = it->second;
+    uint64_t delta[COUNTER_COUNT];
+    bool changed = false;
+    for (int j = 0; j < COUNTER_COUNT; ++j) {
+      delta[j] = counters[j] >= entry.counters[j] ?
+                 counters[j] - entry.counters[j] : 0;
+      changed = changed || delta[j] != 0;
+    }
+    float seconds = (nowMs - entry.readMs) / 1000.0f;
+    entry.readMs = nowMs;
+    memcpy(entry.counters, counters, sizeof(counters));
+    if (!changed || seconds <= 0) {
+      continue;
+    }
+    _rates.emplace_back();
+    auto &rate = _rates.back();
+    rate.pid = pid;
+    rate.identity = table.identityPtr(row);
+    rate.readBytes = delta[READ_BYTES] / seconds;
+    rate.writeBytes = delta[WRITE_BYTES] / seconds;
+    rate.cancelledWriteBytes = delta[CANCELLED_WRITE_BYTES] / seconds;
+    rate.syscr = delta[SYSCR] / seconds;
+    rate.syscw = delta[SYSCW] / seconds;
+  }
+
+  std::sort(_rates.begin(), _rates.end(),
+            [](const ProcIORate &a, const ProcIORate &b) {
+              return a.readBytes + a.writeBytes > b.readBytes + b.writeBytes;
+            });
+  return _rates;
+}
+
+YODA_NS_END
@@ -0,0 +1,69 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_IO_H
+#define YODA_SIXSIX_PROC_IO_H
+
+#include "executor_def.h"
+#include <unordered_map>
+
+YODA_NS_BEGIN
+
+/*
+ * Per second io of one process between two reads of /proc/<pid>/io.
+ */
+struct ProcIORate {
+  uint32_t pid;
+  std::shared_ptr<const ProcessIdentity> identity;
+  float readBytes;
+  float writeBytes;
+  float cancelledWriteBytes;
+  float syscr;
+  float syscw;
+};
+
+/*
+ * Reads /proc/<pid>/io of the top N processes by cpu of a top tick, so the
+ * extra reads per tick are bounded by N. The counters are kept per process
+ * until it exits, a process back in the top N gets its rate over the whole
+ * time since it was last read.
+ */
+class ProcIOSampler {
+public:
+  ProcIOSampler();
+
+  /*
+   * sample the top count processes of table, returns the processes with io
+   * ordered by read and write bytes
+   */
+  const std::vector<ProcIORate> &sample(const std::string &procDir,
+                                        const ProcessTable &table,
+                                        size_t count);
+
+private:
+  enum {
+    SYSCR = 0,
+    SYSCW,
+    READ_BYTES,
+    WRITE_BYTES,
+    CANCELLED_WRITE_BYTES,
+    COUNTER_COUNT
+  };
+
+  struct Entry {
+    uint64_t startTime;
+    uint64_t readMs;
+    uint64_t counters[COUNTER_COUNT];
+  };
+
+  bool readIO(const std::string &procDir, uint32_t pid, uint64_t *counters);
+
+  std::unordered_map<uint32_t, Entry> _entries;
+  std::vector<size_t> _rows;
+  std::vector<ProcIORate> _rates;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_IO_H
@@ -0,0 +1,37 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_scan.h"
+#include <fcntl.h>
+
+YODA_NS_BEGIN
+
+namespace procscan {
+
+ssize_t readFile(const std::string &path, int &fd, std::vector<char> &buf,
+                 size_t maxSize) {
+  if (fd < 0) {
+    fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return -1;
+    }
+  }
+  ssize_t size;
+  while (true) {
+    size = pread(fd, buf.data(), buf.size(), 0);
+    if (size < 0) {
+      return -1;
+    }
+    // a full buffer may have cut the file, read again
+    if ((size_t) size < buf.size() || buf.size() >= maxSize) {
+      break;
+    }
+    buf.resize(buf.size() * 2);
+  }
+  return size;
+}
+
+}
+
+YODA_NS_END
@@ -0,0 +1,58 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_SCAN_H
+#define YODA_SIXSIX_PROC_SCAN_H
+
+#include "def.h"
+#include <cstring>
+
+YODA_NS_BEGIN
+
+/*
+ * Scanners for the text files of procfs and sysfs, they never read past end.
+ */
+namespace procscan {
+
+inline const char *skipSpaces(const char *p, const char *end) {
+  while (p < end && *p == ' ') ++p;
+  return p;
+}
+
+/*
+ * scan the unsigned integer at p, returns false if there is none
+ */
+inline bool scanU64(const char *&p, const char *end, uint64_t *n) {
+  p = skipSpaces(p, end);
+  if (p >= end || (uint8_t) (*p - '0') > 9) {
+    return false;
+  }
+  uint64_t v = 0;
+  uint8_t d;
+  while (p < end && (d = (uint8_t) (*p - '0')) <= 9) {
+    v = v * 10 + d;
+    ++p;
+  }
+  *n = v;
+  return true;
+}
+
+inline const char *nextLine(const char *p, const char *end) {
+  auto nl = (const char *) memchr(p, '\n', end - p);
+  return nl ? nl + 1 : end;
+}
+
+/*
+ * pread the whole file into buf, fd is opened on the first call and kept.
+ * buf grows up to maxSize if the file does not fit, returns the size read
+ * or -1 on error
+ */
+ssize_t readFile(const std::string &path, int &fd, std::vector<char> &buf,
+                 size_t maxSize);
+
+}
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_SCAN_H
@@ -0,0 +1,168 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "proc_stat.h"
+#include "proc_scan.h"
+
+#define PROC_STAT_BUFSIZE (16 * 1024)
+#define PROC_STAT_MAX_BUFSIZE (1024 * 1024)
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+namespace {
+
+// FNV-1a, usable in case labels
+constexpr uint32_t statKey(const char *s, uint32_t h = 2166136261u) {
+  return *s ? statKey(s + 1, (h ^ (uint8_t) *s) * 16777619u) : h;
+}
+
+inline uint32_t statKey(const char *s, const char *end) {
+  uint32_t h = 2166136261u;
+  for (; s < end; ++s) {
+    h = (h ^ (uint8_t) *s) * 16777619u;
+  }
+  return h;
+}
+
+}
+
+ProcStatReader::ProcStatReader(const std::string &path) :
+  _path(path),
+  _fd(-1),
+  _buf(PROC_STAT_BUFSIZE),
+  _total(),
+  _cores(),
+  _counters(),
+  _ctxt(0),
+  _intr(0),
+  _softirq(0),
+  _processes(0),
+  _lastCtxt(0),
+  _lastIntr(0),
+  _lastSoftirq(0),
+  _lastProcesses(0),
+  _lastReadMs(0) {
+
+}
+
+ProcStatReader::~ProcStatReader() {
+  if (_fd >= 0) {
+    close(_fd);
+  }
+}
+
+int32_t ProcStatReader::read() {
+  // the intr line grows with the irq count
+  ssize_t size = procscan::readFile(_path, _fd, _buf, PROC_STAT_MAX_BUFSIZE);
+  if (size < 0) {
+    return -1;
+  }
+  int32_t r = this->parse(_buf.data(), _buf.data() + size);
+  if (r != 0) {
+    return r;
+  }
+  this->updateCounters(uv_hrtime() / 1000000);
+  return 0;
+}
+
+int32_t ProcStatReader::parse(const char *p, const char *end) {
+  bool hasTotal = false;
+  size_t core = 0;
+  while (p < end) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    // one cpu line per core, keep them out of the switch
+    if (eol - line > 3 && line[0] == 'c' && line[1] == 'p' && line[2] == 'u') {
+      CPUJif *jif;
+      const char *cp = line + 3;
+      if (*cp == ' ') {
+        jif = &_total;
+        hasTotal = true;
+      } else {
+        if (core == _cores.size()) {
+          _cores.emplace_back();
+        }
+        jif = &_cores[core++];
+        uint64_t cpu = 0;
+        scanU64(cp, eol, &cpu);
+        jif->cpu = (uint32_t) cpu;
+        while (cp < eol && *cp != ' ') ++cp;
+      }
+      uint64_t *fields[] = {
+        &jif->usr, &jif->nic, &jif->sys, &jif->idle,
+        &jif->iowait, &jif->irq, &jif->softirq, &jif->steal
+      };
+      int32_t count = 0;
+      for (auto field : fields) {
+        if (!scanU64(cp, eol, field)) {
+          *field = 0;
+        } else {
+          ++count;
+        }
+      }
+      if (count < 4) {
+        return -2;
+      }
+      continue;
+    }
+    const char *sep = (const char *) memchr(line, ' ', eol - line);
+    if (!sep) {
+      continue;
+    }
+    const char *cp = sep;
+    uint64_t value;
+    switch (statKey(line, sep)) {
+      case statKey("ctxt"):
+        if (scanU64(cp, eol, &value)) _ctxt = value;
+        break;
+      case statKey("intr"):
+        // the first value is the sum of all irqs
+        if (scanU64(cp, eol, &value)) _intr = value;
+        break;
+      case statKey("softirq"):
+        if (scanU64(cp, eol, &value)) _softirq = value;
+        break;
+      case statKey("processes"):
+        if (scanU64(cp, eol, &value)) _processes = value;
+        break;
+      case statKey("procs_running"):
+        if (scanU64(cp, eol, &value)) {
+          _counters.procsRunning = (uint32_t) value;
+        }
+        break;
+      case statKey("procs_blocked"):
+        if (scanU64(cp, eol, &value)) {
+          _counters.procsBlocked = (uint32_t) value;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  if (!hasTotal) {
+    return -1;
+  }
+  _cores.resize(core);
+  return 0;
+}
+
+void ProcStatReader::updateCounters(uint64_t nowMs) {
+  if (_lastReadMs != 0 && nowMs > _lastReadMs) {
+    float seconds = (nowMs - _lastReadMs) / 1000.0f;
+    _counters.ctxtRate = (_ctxt - _lastCtxt) / seconds;
+    _counters.intrRate = (_intr - _lastIntr) / seconds;
+    _counters.softirqRate = (_softirq - _lastSoftirq) / seconds;
+    _counters.forkRate = (_processes - _lastProcesses) / seconds;
+  }
+  _lastCtxt = _ctxt;
+  _lastIntr = _intr;
+  _lastSoftirq = _softirq;
+  _lastProcesses = _processes;
+  _lastReadMs = nowMs;
+}
+
+YODA_NS_END
@@ -0,0 +1,76 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROC_STAT_H
+#define YODA_SIXSIX_PROC_STAT_H
+
+#include "executor_def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Parses /proc/stat with one pread of a kept fd into a reused buffer.
+ */
+class ProcStatReader {
+public:
+  struct CPUJif {
+    // N of the cpuN label
+    uint32_t cpu;
+    uint64_t usr;
+    uint64_t nic;
+    uint64_t sys;
+    uint64_t idle;
+    uint64_t iowait;
+    uint64_t irq;
+    uint64_t softirq;
+    uint64_t steal;
+  };
+
+  explicit ProcStatReader(const std::string &path);
+
+  ~ProcStatReader();
+
+  /*
+   * read and parse the file, returns 0 on success
+   */
+  int32_t read();
+
+  const CPUJif &total() const { return _total; }
+
+  /*
+   * the cpu<N> lines in file order, offline cpus have no line
+   */
+  const std::vector<CPUJif> &cores() const { return _cores; }
+
+  /*
+   * counters of the last read, rates are per second since the read
+   * before it
+   */
+  const SystemCounters &counters() const { return _counters; }
+
+private:
+  int32_t parse(const char *p, const char *end);
+
+  void updateCounters(uint64_t nowMs);
+
+  std::string _path;
+  int _fd;
+  std::vector<char> _buf;
+  CPUJif _total;
+  std::vector<CPUJif> _cores;
+  SystemCounters _counters;
+  uint64_t _ctxt;
+  uint64_t _intr;
+  uint64_t _softirq;
+  uint64_t _processes;
+  uint64_t _lastCtxt;
+  uint64_t _lastIntr;
+  uint64_t _lastSoftirq;
+  uint64_t _lastProcesses;
+  uint64_t _lastReadMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROC_STAT_H
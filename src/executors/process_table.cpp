@@ -0,0 +1,211 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "process_table.h"
+
+#define MIN_CAPACITY 512
+
+YODA_NS_BEGIN
+
+static inline uint32_t hashPid(uint32_t pid) {
+  // an odd multiplier maps consecutive pids to distinct slots
+  return pid * 2654435761u;
+}
+
+ProcessTable::ProcessTable() : _slots(MIN_CAPACITY, 0),
+                               _mask(MIN_CAPACITY - 1) {
+
+}
+
+void ProcessTable::clear() {
+  std::fill(_slots.begin(), _slots.end(), 0);
+  _pids.clear();
+  _states.clear();
+  _identities.clear();
+  _ppids.clear();
+  _pgids.clear();
+  _sids.clear();
+  _ttyMinors.clear();
+  _ttyMajors.clear();
+  _utimes.clear();
+  _stimes.clear();
+  _ticks.clear();
+  _startTimes.clear();
+  _vszs.clear();
+  _rsss.clear();
+  _nices.clear();
+  _lastSeenOnCPUs.clear();
+  _ticksDeltas.clear();
+  _cpuUsagePercents.clear();
+  _minFlts.clear();
+  _majFlts.clear();
+  _hasSwitches.clear();
+  _nvcsws.clear();
+  _nivcsws.clear();
+  _minFltRates.clear();
+  _majFltRates.clear();
+  _nvcswRates.clear();
+  _nivcswRates.clear();
+  _hasSchedStats.clear();
+  _runTimes.clear();
+  _waitTimes.clear();
+  _timeslices.clear();
+  _runDeltas.clear();
+  _waitDeltas.clear();
+  _timeslicesDeltas.clear();
+  _sampleTimes.clear();
+}
+
+int64_t ProcessTable::find(uint32_t pid) const {
+  for (uint32_t i = hashPid(pid) & _mask;; i = (i + 1) & _mask) {
+    uint32_t slot = _slots[i];
+    if (slot == 0) {
+      return -1;
+    }
+    if (_pids[slot - 1] == pid) {
+      return slot - 1;
+    }
+  }
+}
+
+size_t ProcessTable::insert(const ProcessTopInfo &info) {
+  int64_t found = this->find(info.pid);
+  size_t row;
+  if (found >= 0) {
+    row = (size_t) found;
+  } else {
+    row = _pids.size();
+    // keep the load factor under 1/2
+    if ((row + 1) * 2 > _slots.size()) {
+      this->rehash(_slots.size() * 2);
+    }
+    uint32_t i = hashPid(info.pid) & _mask;
+    while (_slots[i] != 0) {
+      i = (i + 1) & _mask;
+    }
+    _slots[i] = (uint32_t) row + 1;
+    _pids.push_back(info.pid);
+    _states.resize(_states.size() + STATE_SIZE);
+    _identities.emplace_back();
+    _ppids.emplace_back();
+    _pgids.emplace_back();
+    _sids.emplace_back();
+    _ttyMinors.emplace_back();
+    _ttyMajors.emplace_back();
+    _utimes.emplace_back();
+    _stimes.emplace_back();
+    _ticks.emplace_back();
+    _startTimes.emplace_back();
+    _vszs.emplace_back();
+    _rsss.emplace_back();
+    _nices.emplace_back();
+    _lastSeenOnCPUs.emplace_back();
+    _ticksDeltas.emplace_back();
+    _cpuUsagePercents.emplace_back();
+    _minFlts.emplace_back();
+    _majFlts.emplace_back();
+    _hasSwitches.emplace_back();
+    _nvcsws.emplace_back();
+    _nivcsws.emplace_back();
+    _minFltRates.emplace_back();
+    _majFltRates.emplace_back();
+    _nvcswRates.emplace_back();
+    _nivcswRates.emplace_back();
+    _hasSchedStats.emplace_back();
+    _runTimes.emplace_back();
+    _waitTimes.emplace_back();
+    _timeslices.emplace_back();
+    _runDeltas.emplace_back();
+    _waitDeltas.emplace_back();
+    _timeslicesDeltas.emplace_back();
+    _sampleTimes.emplace_back();
+  }
+  memcpy(&_states[row * STATE_SIZE], info.state, STATE_SIZE);
+  _identities[row] = info.identity;
+  _ppids[row] = info.ppid;
+  _pgids[row] = info.pgid;
+  _sids[row] = info.sid;
+  _ttyMinors[row] = info.ttyMinor;
+  _ttyMajors[row] = info.ttyMajor;
+  _utimes[row] = info.utime;
+  _stimes[row] = info.stime;
+  _ticks[row] = info.ticks;
+  _startTimes[row] = info.startTime;
+  _vszs[row] = info.vsz;
+  _rsss[row] = info.rss;
+  _nices[row] = info.nice;
+  _lastSeenOnCPUs[row] = info.lastSeenOnCPU;
+  _ticksDeltas[row] = info.ticksDelta;
+  _cpuUsagePercents[row] = info.cpuUsagePercent;
+  _minFlts[row] = info.minFlt;
+  _majFlts[row] = info.majFlt;
+  _hasSwitches[row] = info.hasSwitches;
+  _nvcsws[row] = info.nvcsw;
+  _nivcsws[row] = info.nivcsw;
+  _minFltRates[row] = info.minFltRate;
+  _majFltRates[row] = info.majFltRate;
+  _nvcswRates[row] = info.nvcswRate;
+  _nivcswRates[row] = info.nivcswRate;
+  _hasSchedStats[row] = info.hasSchedStat;
+  _runTimes[row] = info.runTime;
+  _waitTimes[row] = info.waitTime;
+  _timeslices[row] = info.timeslices;
+  _runDeltas[row] = info.runDelta;
+  _waitDeltas[row] = info.waitDelta;
+  _timeslicesDeltas[row] = info.timeslicesDelta;
+  _sampleTimes[row] = info.sampleTime;
+  return row;
+}
+
+void ProcessTable::get(size_t row, ProcessTopInfo &info) const {
+  info.pid = _pids[row];
+  memcpy(info.state, &_states[row * STATE_SIZE], STATE_SIZE);
+  info.identity = _identities[row];
+  info.ppid = _ppids[row];
+  info.pgid = _pgids[row];
+  info.sid = _sids[row];
+  info.ttyMinor = _ttyMinors[row];
+  info.ttyMajor = _ttyMajors[row];
+  info.utime = _utimes[row];
+  info.stime = _stimes[row];
+  info.ticks = _ticks[row];
+  info.startTime = _startTimes[row];
+  info.vsz = _vszs[row];
+  info.rss = _rsss[row];
+  info.nice = _nices[row];
+  info.lastSeenOnCPU = _lastSeenOnCPUs[row];
+  info.ticksDelta = _ticksDeltas[row];
+  info.cpuUsagePercent = _cpuUsagePercents[row];
+  info.minFlt = _minFlts[row];
+  info.majFlt = _majFlts[row];
+  info.hasSwitches = _hasSwitches[row] != 0;
+  info.nvcsw = _nvcsws[row];
+  info.nivcsw = _nivcsws[row];
+  info.minFltRate = _minFltRates[row];
+  info.majFltRate = _majFltRates[row];
+  info.nvcswRate = _nvcswRates[row];
+  info.nivcswRate = _nivcswRates[row];
+  info.hasSchedStat = _hasSchedStats[row] != 0;
+  info.runTime = _runTimes[row];
+  info.waitTime = _waitTimes[row];
+  info.timeslices = _timeslices[row];
+  info.runDelta = _runDeltas[row];
+  info.waitDelta = _waitDeltas[row];
+  info.timeslicesDelta = _timeslicesDeltas[row];
+  info.sampleTime = _sampleTimes[row];
+}
+
+void ProcessTable::rehash(size_t capacity) {
+  _slots.assign(capacity, 0);
+  _mask = (uint32_t) capacity - 1;
+  for (size_t row = 0; row < _pids.size(); ++row) {
+    uint32_t i = hashPid(_pids[row]) & _mask;
+    while (_slots[i] != 0) {
+      i = (i + 1) & _mask;
+    }
+    _slots[i] = (uint32_t) row + 1;
+  }
+}
+
+YODA_NS_END
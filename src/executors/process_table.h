@@ -0,0 +1,159 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_PROCESS_TABLE_H
+#define YODA_SIXSIX_PROCESS_TABLE_H
+
+#include "executor_def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Process samples of one top tick, stored column by column with an
+ * open-addressing pid index. clear() keeps the capacity, so a table
+ * reused every tick stops allocating once it has seen the process count.
+ */
+class ProcessTable {
+public:
+  ProcessTable();
+
+  void clear();
+
+  size_t size() const { return _pids.size(); }
+
+  /*
+   * insert the sample of info.pid, replaces the row if pid exists,
+   * returns the row
+   */
+  size_t insert(const ProcessTopInfo &info);
+
+  /*
+   * returns the row of pid, or -1
+   */
+  int64_t find(uint32_t pid) const;
+
+  /*
+   * copy a row out, for the rare lookups by pid
+   */
+  void get(size_t row, ProcessTopInfo &info) const;
+
+  void setCpuUsage(size_t row, uint64_t ticksDelta, float percent) {
+    _ticksDeltas[row] = ticksDelta;
+    _cpuUsagePercents[row] = percent;
+  }
+
+  uint32_t pid(size_t row) const { return _pids[row]; }
+
+  const char *state(size_t row) const { return &_states[row * STATE_SIZE]; }
+
+  const ProcessIdentity &identity(size_t row) const {
+    return *_identities[row];
+  }
+
+  const std::shared_ptr<const ProcessIdentity> &identityPtr(size_t row) const {
+    return _identities[row];
+  }
+
+  int32_t nice(size_t row) const { return _nices[row]; }
+
+  uint64_t utime(size_t row) const { return _utimes[row]; }
+
+  uint64_t stime(size_t row) const { return _stimes[row]; }
+
+  uint64_t ticks(size_t row) const { return _ticks[row]; }
+
+  uint64_t startTime(size_t row) const { return _startTimes[row]; }
+
+  // kB
+  uint64_t rss(size_t row) const { return _rsss[row]; }
+
+  uint64_t ticksDelta(size_t row) const { return _ticksDeltas[row]; }
+
+  float cpuUsagePercent(size_t row) const { return _cpuUsagePercents[row]; }
+
+  uint64_t minFlt(size_t row) const { return _minFlts[row]; }
+
+  uint64_t majFlt(size_t row) const { return _majFlts[row]; }
+
+  bool hasSwitches(size_t row) const { return _hasSwitches[row] != 0; }
+
+  uint64_t nvcsw(size_t row) const { return _nvcsws[row]; }
+
+  uint64_t nivcsw(size_t row) const { return _nivcsws[row]; }
+
+  float minFltRate(size_t row) const { return _minFltRates[row]; }
+
+  float majFltRate(size_t row) const { return _majFltRates[row]; }
+
+  float nvcswRate(size_t row) const { return _nvcswRates[row]; }
+
+  float nivcswRate(size_t row) const { return _nivcswRates[row]; }
+
+  bool hasSchedStat(size_t row) const { return _hasSchedStats[row] != 0; }
+
+  uint64_t runTime(size_t row) const { return _runTimes[row]; }
+
+  uint64_t waitTime(size_t row) const { return _waitTimes[row]; }
+
+  uint64_t timeslices(size_t row) const { return _timeslices[row]; }
+
+  uint64_t runDelta(size_t row) const { return _runDeltas[row]; }
+
+  uint64_t waitDelta(size_t row) const { return _waitDeltas[row]; }
+
+  uint64_t timeslicesDelta(size_t row) const {
+    return _timeslicesDeltas[row];
+  }
+
+  uint64_t sampleTime(size_t row) const { return _sampleTimes[row]; }
+
+private:
+  static const size_t STATE_SIZE = sizeof(ProcessTopInfo::state);
+
+  void rehash(size_t capacity);
+
+  // slot holds row + 1, 0 is empty
+  std::vector<uint32_t> _slots;
+  uint32_t _mask;
+
+  std::vector<uint32_t> _pids;
+  std::vector<char> _states;
+  std::vector<std::shared_ptr<const ProcessIdentity>> _identities;
+  std::vector<uint32_t> _ppids;
+  std::vector<uint32_t> _pgids;
+  std::vector<uint32_t> _sids;
+  std::vector<uint32_t> _ttyMinors;
+  std::vector<uint32_t> _ttyMajors;
+  std::vector<uint64_t> _utimes;
+  std::vector<uint64_t> _stimes;
+  std::vector<uint64_t> _ticks;
+  std::vector<uint64_t> _startTimes;
+  std::vector<uint64_t> _vszs;
+  std::vector<uint64_t> _rsss;
+  std::vector<int32_t> _nices;
+  std::vector<int32_t> _lastSeenOnCPUs;
+  std::vector<uint64_t> _ticksDeltas;
+  std::vector<float> _cpuUsagePercents;
+  std::vector<uint64_t> _minFlts;
+  std::vector<uint64_t> _majFlts;
+  std::vector<uint8_t> _hasSwitches;
+  std::vector<uint64_t> _nvcsws;
+  std::vector<uint64_t> _nivcsws;
+  std::vector<float> _minFltRates;
+  std::vector<float> _majFltRates;
+  std::vector<float> _nvcswRates;
+  std::vector<float> _nivcswRates;
+  std::vector<uint8_t> _hasSchedStats;
+  std::vector<uint64_t> _runTimes;
+  std::vector<uint64_t> _waitTimes;
+  std::vector<uint64_t> _timeslices;
+  std::vector<uint64_t> _runDeltas;
+  std::vector<uint64_t> _waitDeltas;
+  std::vector<uint64_t> _timeslicesDeltas;
+  std::vector<uint64_t> _sampleTimes;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_PROCESS_TABLE_H
@@ -0,0 +1,83 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "scan_workers.h"
+
+YODA_NS_BEGIN
+
+ScanWorkers::ScanWorkers() : _threads(),
+                             _mutex(),
+                             _startCond(),
+                             _doneCond(),
+                             _task(nullptr),
+                             _generation(0),
+                             _pending(0),
+                             _stopping(false) {
+
+}
+
+ScanWorkers::~ScanWorkers() {
+  this->stop();
+}
+
+void ScanWorkers::start(size_t shards) {
+  ASSERT(_threads.empty(), "scan workers are running");
+  _stopping = false;
+  for (size_t shard = 1; shard < shards; ++shard) {
+    _threads.emplace_back(&ScanWorkers::loop, this, shard, _generation);
+  }
+}
+
+void ScanWorkers::stop() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _startCond.notify_all();
+  for (auto &thread : _threads) {
+    thread.join();
+  }
+  _threads.clear();
+}
+
+void ScanWorkers::run(const std::function<void(size_t)> &task) {
+  if (!_threads.empty()) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _task = &task;
+    _pending = _threads.size();
+    ++_generation;
+  }
+  _startCond.notify_all();
+  task(0);
+  if (!_threads.empty()) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCond.wait(lock, [this] { return _pending == 0; });
+    _task = nullptr;
+  }
+}
+
+void ScanWorkers::loop(size_t shard, uint64_t generation) {
+  while (true) {
+    const std::function<void(size_t)> *task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _startCond.wait(lock, [this, generation] {
+        return _stopping || _generation != generation;
+      });
+      if (_stopping) {
+        return;
+      }
+      generation = _generation;
+      task = _task;
+    }
+    (*task)(shard);
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      --_pending;
+    }
+    _doneCond.notify_one();
+  }
+}
+
+YODA_NS_END
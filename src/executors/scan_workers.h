@@ -0,0 +1,52 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_SCAN_WORKERS_H
+#define YODA_SIXSIX_SCAN_WORKERS_H
+
+#include "def.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+YODA_NS_BEGIN
+
+/*
+ * Fixed threads which run one task per shard for the sampler. The calling
+ * thread runs shard 0, so n shards need n - 1 threads.
+ */
+class ScanWorkers {
+public:
+  ScanWorkers();
+
+  ~ScanWorkers();
+
+  void start(size_t shards);
+
+  void stop();
+
+  size_t shards() const { return _threads.size() + 1; }
+
+  /*
+   * run task(shard) for every shard, returns when all are done
+   */
+  void run(const std::function<void(size_t)> &task);
+
+private:
+  void loop(size_t shard, uint64_t generation);
+
+  std::vector<std::thread> _threads;
+  std::mutex _mutex;
+  std::condition_variable _startCond;
+  std::condition_variable _doneCond;
+  const std::function<void(size_t)> *_task;
+  uint64_t _generation;
+  size_t _pending;
+  bool _stopping;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_SCAN_WORKERS_H
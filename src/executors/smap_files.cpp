@@ -0,0 +1,141 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "smap_files.h"
+#include <algorithm>
+
+#define MIN_CAPACITY 1024
+
+YODA_NS_BEGIN
+
+static inline uint32_t hashPath(const char *path, size_t len) {
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    h = (h ^ (uint8_t) path[i]) * 16777619u;
+  }
+  return h;
+}
+
+SmapFileTable::SmapFileTable() : _slots(MIN_CAPACITY, 0),
+                                 _mask(MIN_CAPACITY - 1),
+                                 _totalPss(0) {
+
+}
+
+void SmapFileTable::beginScan() {
+  // paths of exited processes would pile up across scans
+  auto unused = (size_t) std::count(_processes.begin(), _processes.end(), 0u);
+  if (_processes.size() > MIN_CAPACITY / 2 && unused * 2 > _processes.size()) {
+    this->compact();
+  }
+  std::fill(_pss.begin(), _pss.end(), 0);
+  std::fill(_rss.begin(), _rss.end(), 0);
+  std::fill(_swap.begin(), _swap.end(), 0);
+  std::fill(_processes.begin(), _processes.end(), 0);
+  std::fill(_lastPids.begin(), _lastPids.end(), 0);
+  _totalPss = 0;
+}
+
+uint32_t SmapFileTable::intern(const char *path, size_t len) {
+  uint32_t hash = hashPath(path, len);
+  uint32_t i = hash & _mask;
+  for (;; i = (i + 1) & _mask) {
+    uint32_t slot = _slots[i];
+    if (slot == 0) {
+      break;
+    }
+    uint32_t id = slot - 1;
+    if (_hashes[id] == hash && _lengths[id] == len &&
+        memcmp(&_arena[_offsets[id]], path, len) == 0) {
+      return id;
+    }
+  }
+  auto id = (uint32_t) _offsets.size();
+  _offsets.push_back((uint32_t) _arena.size());
+  _lengths.push_back((uint32_t) len);
+  _hashes.push_back(hash);
+  _arena.insert(_arena.end(), path, path + len);
+  _pss.push_back(0);
+  _rss.push_back(0);
+  _swap.push_back(0);
+  _processes.push_back(0);
+  _lastPids.push_back(0);
+  _slots[i] = id + 1;
+  // keep the load factor under 1/2
+  if ((id + 1) * 2 > _slots.size()) {
+    this->rehash(_slots.size() * 2);
+  }
+  return id;
+}
+
+void SmapFileTable::add(uint32_t id, uint32_t pid, uint64_t pss, uint64_t rss,
+                        uint64_t swap) {
+  _pss[id] += pss;
+  _rss[id] += rss;
+  _swap[id] += swap;
+  _totalPss += pss;
+  if (_lastPids[id] != pid) {
+    _lastPids[id] = pid;
+    ++_processes[id];
+  }
+}
+
+void SmapFileTable::top(size_t count, std::vector<uint32_t> &ids) const {
+  ids.clear();
+  for (uint32_t id = 0; id < _pss.size(); ++id) {
+    if (_pss[id] > 0) {
+      ids.push_back(id);
+    }
+  }
+  count = std::min(count, ids.size());
+  std::partial_sort(ids.begin(), ids.begin() + count, ids.end(),
+                    [this](uint32_t a, uint32_t b) {
+                      return _pss[a] > _pss[b];
+                    });
+  ids.resize(count);
+}
+
+void SmapFileTable::rehash(size_t capacity) {
+  _slots.assign(capacity, 0);
+  _mask = (uint32_t) capacity - 1;
+  for (uint32_t id = 0; id < _hashes.size(); ++id) {
+    uint32_t i = _hashes[id] & _mask;
+    while (_slots[i] != 0) {
+      i = (i + 1) & _mask;
+    }
+    _slots[i] = id + 1;
+  }
+}
+
+/*
+ * drop the paths nobody mapped in the last scan, ids change
+ */
+void SmapFileTable::compact() {
+  std::vector<char> arena;
+  uint32_t kept = 0;
+  for (uint32_t id = 0; id < _offsets.size(); ++id) {
+    if (_processes[id] == 0) {
+      continue;
+    }
+    auto begin = _arena.begin() + _offsets[id];
+    _offsets[kept] = (uint32_t) arena.size();
+    arena.insert(arena.end(), begin, begin + _lengths[id]);
+    _lengths[kept] = _lengths[id];
+    _hashes[kept] = _hashes[id];
+    ++kept;
+  }
+  _arena.swap(arena);
+  _offsets.resize(kept);
+  _lengths.resize(kept);
+  _hashes.resize(kept);
+  _pss.resize(kept);
+  _rss.resize(kept);
+  _swap.resize(kept);
+  _processes.resize(kept);
+  _lastPids.resize(kept);
+  this->rehash(_slots.size());
+}
+
+YODA_NS_END
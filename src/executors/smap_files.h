@@ -0,0 +1,84 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_SMAP_FILES_H
+#define YODA_SIXSIX_SMAP_FILES_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Pss, rss and swap of the mappings of all processes summed by mapped
+ * file, anon regions sum up under their [name].
+ *
+ * Paths are interned once into one char arena with an open-addressing
+ * index, a path is an id from then on. The sums are flat vectors indexed by
+ * id which are zeroed, not freed, by beginScan().
+ */
+class SmapFileTable {
+public:
+  SmapFileTable();
+
+  void beginScan();
+
+  /*
+   * the id of path, interned on its first use
+   */
+  uint32_t intern(const char *path, size_t len);
+
+  /*
+   * add one mapping of pid, mappings of one process are added together
+   */
+  void add(uint32_t id, uint32_t pid, uint64_t pss, uint64_t rss,
+           uint64_t swap);
+
+  /*
+   * ids of the count largest pss sums, largest first
+   */
+  void top(size_t count, std::vector<uint32_t> &ids) const;
+
+  std::string path(uint32_t id) const {
+    return std::string(&_arena[_offsets[id]], _lengths[id]);
+  }
+
+  uint64_t pss(uint32_t id) const { return _pss[id]; }
+
+  uint64_t rss(uint32_t id) const { return _rss[id]; }
+
+  uint64_t swap(uint32_t id) const { return _swap[id]; }
+
+  /*
+   * processes which mapped the path
+   */
+  uint32_t processes(uint32_t id) const { return _processes[id]; }
+
+  uint64_t totalPss() const { return _totalPss; }
+
+  size_t size() const { return _offsets.size(); }
+
+private:
+  void rehash(size_t capacity);
+
+  void compact();
+
+  // slot holds id + 1, 0 is empty
+  std::vector<uint32_t> _slots;
+  uint32_t _mask;
+  std::vector<char> _arena;
+  std::vector<uint32_t> _offsets;
+  std::vector<uint32_t> _lengths;
+  std::vector<uint32_t> _hashes;
+  std::vector<uint64_t> _pss;
+  std::vector<uint64_t> _rss;
+  std::vector<uint64_t> _swap;
+  std::vector<uint32_t> _processes;
+  // the pid which added to the id last, to count each process once
+  std::vector<uint32_t> _lastPids;
+  uint64_t _totalPss;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_SMAP_FILES_H
@@ -0,0 +1,198 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "smaps_parser.h"
+
+#define CHUNK_SIZE (64 * 1024)
+
+YODA_NS_BEGIN
+
+static constexpr uint32_t key4(char a, char b, char c, char d) {
+  return (uint32_t) (uint8_t) a | (uint32_t) (uint8_t) b << 8 |
+         (uint32_t) (uint8_t) c << 16 | (uint32_t) (uint8_t) d << 24;
+}
+
+static inline bool isKey(const char *p, const char *end, const char *key,
+                         size_t len) {
+  return (size_t) (end - p) >= len && memcmp(p, key, len) == 0;
+}
+
+/*
+ * "   nnn kB" after the key
+ */
+static inline uint64_t parseKb(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t')) ++p;
+  uint64_t n = 0;
+  for (; p < end && (unsigned) (*p - '0') <= 9; ++p) {
+    n = n * 10 + (*p - '0');
+  }
+  return n;
+}
+
+static inline uint64_t parseHex(const char *&p, const char *end) {
+  uint64_t n = 0;
+  for (; p < end; ++p) {
+    unsigned c = (unsigned) (*p | 0x20) - '0';
+    if (c > 9) {
+      c -= 'a' - '0' - 10;
+      if (c < 10 || c > 15) {
+        break;
+      }
+    }
+    n = n << 4 | c;
+  }
+  return n;
+}
+
+SmapsParser::SmapsParser() : _buf(CHUNK_SIZE),
+                             _bytes(0),
+                             _files(nullptr),
+                             _fileId(UINT32_MAX),
+                             _pss(0),
+                             _rss(0),
+                             _swap(0) {
+
+}
+
+bool SmapsParser::parse(int fd, ProcessSmapInfo &total,
+                        SmapFileTable *files) {
+  _bytes = 0;
+  _files = files;
+  _fileId = UINT32_MAX;
+  size_t carry = 0;
+  for (;;) {
+    // a line longer than the buffer, paths are at most PATH_MAX though
+    if (carry == _buf.size()) {
+      _buf.resize(_buf.size() * 2);
+    }
+    ssize_t size = read(fd, _buf.data() + carry, _buf.size() - carry);
+    if (size < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (size == 0) {
+      break;
+    }
+    _bytes += size;
+    const char *p = _buf.data();
+    const char *end = p + carry + size;
+    const char *nl;
+    while ((nl = (const char *) memchr(p, '\n', end - p)) != nullptr) {
+      this->parseLine(p, nl, total);
+      p = nl + 1;
+    }
+    carry = end - p;
+    if (carry > 0) {
+      memmove(_buf.data(), p, carry);
+    }
+  }
+  if (carry > 0) {
+    this->parseLine(_buf.data(), _buf.data() + carry, total);
+  }
+  this->flushMapping(total.pid);
+  _files = nullptr;
+  return true;
+}
+
+void SmapsParser::parseLine(const char *p, const char *end,
+                            ProcessSmapInfo &total) {
+  // Each mapping datum has this form:
+  // f7d29000-f7d39000 rw-s FILEOFS M:m INODE FILENAME
+  // Size:                nnn kB
+  // Rss:                 nnn kB
+  // .....
+  if (end - p < 4) {
+    return;
+  }
+  switch (key4(p[0], p[1], p[2], p[3])) {
+    case key4('R', 's', 's', ':'):
+      total.rss += _rss = parseKb(p + 4, end);
+      return;
+    case key4('P', 's', 's', ':'):
+      total.pss += _pss = parseKb(p + 4, end);
+      return;
+    case key4('S', 'w', 'a', 'p'):
+      // not SwapPss:
+      if (isKey(p, end, "Swap:", 5)) {
+        total.swap += _swap = parseKb(p + 5, end);
+      }
+      return;
+    case key4('P', 'r', 'i', 'v'):
+      if (isKey(p, end, "Private_Dirty:", 14)) {
+        total.private_dirty += parseKb(p + 14, end);
+      } else if (isKey(p, end, "Private_Clean:", 14)) {
+        total.private_clean += parseKb(p + 14, end);
+      }
+      return;
+    case key4('S', 'h', 'a', 'r'):
+      if (isKey(p, end, "Shared_Dirty:", 13)) {
+        total.shared_dirty += parseKb(p + 13, end);
+      } else if (isKey(p, end, "Shared_Clean:", 13)) {
+        total.shared_clean += parseKb(p + 13, end);
+      }
+      return;
+    default:
+      break;
+  }
+  // keys start upper case, a mapping with its hex start address
+  if ((unsigned) (*p - '0') <= 9 || (unsigned) (*p - 'a') <= 5) {
+    this->parseMapping(p, end, total);
+  }
+}
+
+void SmapsParser::parseMapping(const char *p, const char *end,
+                               ProcessSmapInfo &total) {
+  this->flushMapping(total.pid);
+
+  uint64_t start = parseHex(p, end);
+  if (p == end || *p != '-') {
+    return;
+  }
+  ++p;
+  uint64_t size = (parseHex(p, end) - start) >> 10;
+  ++p;
+  // rw-s
+  char write = end - p > 1 ? p[1] : '\0';
+  // skipping "rw-s FILEOFS M:m INODE "
+  for (int i = 0; i < 4 && p < end; ++i) {
+    while (p < end && *p != ' ') ++p;
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+  }
+  const char *path = p;
+  while (p < end && *p != ' ' && *p != '\t') ++p;
+  size_t len = p - path;
+  bool whole = p == end;
+
+  // filter out /dev/something (something != zero)
+  if (len < 5 || memcmp(path, "/dev/", 5) != 0 ||
+      (whole && len == 9 && memcmp(path, "/dev/zero", 9) == 0)) {
+    if (write == 'w') {
+      total.rw += size;
+    } else if (write == '-') {
+      total.ro += size;
+    }
+  }
+  if (whole && len == 7 && memcmp(path, "[stack]", 7) == 0) {
+    total.stack += size;
+  }
+  if (_files) {
+    _fileId = len == 0 ? _files->intern("[anon]", 6)
+                       : _files->intern(path, len);
+  }
+  total.size += size;
+}
+
+void SmapsParser::flushMapping(uint32_t pid) {
+  if (_files && _fileId != UINT32_MAX) {
+    _files->add(_fileId, pid, _pss, _rss, _swap);
+  }
+  _fileId = UINT32_MAX;
+  _pss = 0;
+  _rss = 0;
+  _swap = 0;
+}
+
+YODA_NS_END
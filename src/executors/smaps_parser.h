@@ -0,0 +1,53 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_SMAPS_PARSER_H
+#define YODA_SIXSIX_SMAPS_PARSER_H
+
+#include "executor_def.h"
+#include "smap_files.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Parses /proc/<pid>/smaps from 64k reads into one reused buffer. Lines are
+ * split with memchr and parsed in place, only the partial line at the end
+ * of a chunk is moved to the front for the next read. A key line is picked
+ * by a switch on its first 4 bytes.
+ */
+class SmapsParser {
+public:
+  SmapsParser();
+
+  /*
+   * add the mappings of fd to total, and to files if there is one,
+   * returns false on a read error
+   */
+  bool parse(int fd, ProcessSmapInfo &total, SmapFileTable *files);
+
+  /*
+   * bytes read by the last parse
+   */
+  uint64_t bytes() const { return _bytes; }
+
+private:
+  void parseLine(const char *p, const char *end, ProcessSmapInfo &total);
+
+  void parseMapping(const char *p, const char *end, ProcessSmapInfo &total);
+
+  void flushMapping(uint32_t pid);
+
+  std::vector<char> _buf;
+  uint64_t _bytes;
+  SmapFileTable *_files;
+  // the mapping being parsed, added to _files on the next header
+  uint32_t _fileId;
+  uint64_t _pss;
+  uint64_t _rss;
+  uint64_t _swap;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_SMAPS_PARSER_H
@@ -0,0 +1,122 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "thermal.h"
+#include "proc_scan.h"
+#include "util.h"
+#include <algorithm>
+#include <fcntl.h>
+
+#define ZONE_PREFIX "thermal_zone"
+#define COOLING_PREFIX "cooling_device"
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+/*
+ * pread the integer of a sysfs attribute, it may be negative
+ */
+static bool readInt(int fd, int32_t *value) {
+  char buf[32];
+  ssize_t size = pread(fd, buf, sizeof(buf), 0);
+  if (size <= 0) {
+    return false;
+  }
+  const char *cp = buf;
+  const char *end = buf + size;
+  bool negative = *cp == '-';
+  if (negative) {
+    ++cp;
+  }
+  uint64_t n;
+  if (!scanU64(cp, end, &n)) {
+    return false;
+  }
+  *value = negative ? -(int32_t) n : (int32_t) n;
+  return true;
+}
+
+static std::string readType(const std::string &path) {
+  auto type = Util::readSmallFile(path);
+  while (!type.empty() && (type.back() == '\n' || type.back() == ' ')) {
+    type.pop_back();
+  }
+  return type;
+}
+
+static bool nameOrder(const std::string &a, const std::string &b) {
+  // thermal_zone2 before thermal_zone10
+  if (a.size() != b.size()) {
+    return a.size() < b.size();
+  }
+  return a < b;
+}
+
+ThermalReader::ThermalReader(const std::string &sysroot) :
+  _thermalDir(sysroot + "/sys/class/thermal/"),
+  _zones(),
+  _coolingDevices(),
+  _fds() {
+
+}
+
+ThermalReader::~ThermalReader() {
+  for (auto fd : _fds) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+size_t ThermalReader::open() {
+  auto names = Util::getFileList(_thermalDir);
+  std::sort(names.begin(), names.end(), nameOrder);
+  std::vector<int> coolingFds;
+  for (auto &name : names) {
+    std::string dir = _thermalDir + name + "/";
+    if (name.compare(0, sizeof(ZONE_PREFIX) - 1, ZONE_PREFIX) == 0) {
+      int fd = ::open((dir + "temp").c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+        continue;
+      }
+      _zones.push_back({name, readType(dir + "type"), false, 0});
+      _fds.push_back(fd);
+    } else if (name.compare(0, sizeof(COOLING_PREFIX) - 1,
+                            COOLING_PREFIX) == 0) {
+      int fd = ::open((dir + "cur_state").c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+        continue;
+      }
+      CoolingDeviceStat device = {name, readType(dir + "type"), false, 0, 0};
+      // max_state does not change, read it once
+      int maxFd = ::open((dir + "max_state").c_str(), O_RDONLY | O_CLOEXEC);
+      if (maxFd >= 0) {
+        readInt(maxFd, &device.maxState);
+        close(maxFd);
+      }
+      _coolingDevices.push_back(device);
+      coolingFds.push_back(fd);
+    }
+  }
+  _fds.insert(_fds.end(), coolingFds.begin(), coolingFds.end());
+  return _fds.size();
+}
+
+int32_t ThermalReader::read() {
+  if (_fds.empty()) {
+    return -1;
+  }
+  size_t i = 0;
+  for (auto &zone : _zones) {
+    // a zone whose sensor is off fails with EAGAIN or ENODATA
+    zone.valid = readInt(_fds[i++], &zone.temp);
+  }
+  for (auto &device : _coolingDevices) {
+    device.valid = readInt(_fds[i++], &device.curState);
+  }
+  return 0;
+}
+
+YODA_NS_END
@@ -0,0 +1,65 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_THERMAL_H
+#define YODA_SIXSIX_THERMAL_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+struct ThermalZoneStat {
+  std::string name;
+  std::string type;
+  bool valid;
+  // millidegree Celsius
+  int32_t temp;
+};
+
+struct CoolingDeviceStat {
+  std::string name;
+  std::string type;
+  bool valid;
+  int32_t curState;
+  int32_t maxState;
+};
+
+/*
+ * The thermal zones and cooling devices of /sys/class/thermal. They are
+ * listed once by open(), the temp and cur_state files stay open and are
+ * re-read with pread.
+ */
+class ThermalReader {
+public:
+  explicit ThermalReader(const std::string &sysroot);
+
+  ~ThermalReader();
+
+  /*
+   * list the zones and cooling devices, returns how many were found
+   */
+  size_t open();
+
+  /*
+   * read every zone and cooling device, returns 0 on success
+   */
+  int32_t read();
+
+  const std::vector<ThermalZoneStat> &zones() const { return _zones; }
+
+  const std::vector<CoolingDeviceStat> &coolingDevices() const {
+    return _coolingDevices;
+  }
+
+private:
+  std::string _thermalDir;
+  std::vector<ThermalZoneStat> _zones;
+  std::vector<CoolingDeviceStat> _coolingDevices;
+  // fds of the zone temp files, then of the cooling cur_state files
+  std::vector<int> _fds;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_THERMAL_H
@@ -0,0 +1,138 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#include "vmstat.h"
+#include "proc_scan.h"
+
+#define VMSTAT_BUFSIZE (8 * 1024)
+#define VMSTAT_MAX_BUFSIZE (64 * 1024)
+#define VMSTAT_MAX_SEEDS 4096
+
+YODA_NS_BEGIN
+
+using namespace procscan;
+
+namespace {
+
+// seeded FNV-1a
+inline uint32_t vmstatHash(const char *s, const char *end, uint32_t seed) {
+  uint32_t h = 2166136261u ^ seed;
+  for (; s < end; ++s) {
+    h = (h ^ (uint8_t) *s) * 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+}
+
+VmstatReader::VmstatReader(const std::string &path,
+                           const std::vector<std::string> &names) :
+  _path(path),
+  _fd(-1),
+  _buf(VMSTAT_BUFSIZE),
+  _names(names),
+  _slots(),
+  _seed(0),
+  _mask(0),
+  _found(names.size(), 0),
+  _values(names.size(), 0),
+  _lastValues(names.size(), 0),
+  _rates(names.size(), 0.0f),
+  _lastReadMs(0) {
+  this->buildIndex();
+}
+
+VmstatReader::~VmstatReader() {
+  if (_fd >= 0) {
+    close(_fd);
+  }
+}
+
+void VmstatReader::buildIndex() {
+  size_t size = 4;
+  while (size < _names.size() * 2) {
+    size <<= 1;
+  }
+  while (true) {
+    _slots.assign(size, -1);
+    _mask = (uint32_t) size - 1;
+    for (_seed = 0; _seed < VMSTAT_MAX_SEEDS; ++_seed) {
+      bool collided = false;
+      for (size_t i = 0; i < _names.size() && !collided; ++i) {
+        auto &name = _names[i];
+        uint32_t slot = vmstatHash(name.data(), name.data() + name.size(),
+                                   _seed) & _mask;
+        if (_slots[slot] >= 0) {
+          collided = true;
+        } else {
+          _slots[slot] = (int32_t) i;
+        }
+      }
+      if (!collided) {
+        LOG_VERBOSE("vmstat index: %zu names, %zu slots, seed %u",
+                    _names.size(), size, _seed);
+        return;
+      }
+      _slots.assign(size, -1);
+    }
+    size <<= 1;
+  }
+}
+
+int32_t VmstatReader::lookup(const char *key, const char *end) const {
+  int32_t i = _slots[vmstatHash(key, end, _seed) & _mask];
+  if (i < 0) {
+    return -1;
+  }
+  auto &name = _names[i];
+  if (name.size() != (size_t) (end - key) ||
+      memcmp(name.data(), key, name.size()) != 0) {
+    return -1;
+  }
+  return i;
+}
+
+int32_t VmstatReader::read() {
+  ssize_t size = readFile(_path, _fd, _buf, VMSTAT_MAX_BUFSIZE);
+  if (size < 0) {
+    return -1;
+  }
+  std::fill(_found.begin(), _found.end(), 0);
+  const char *p = _buf.data();
+  const char *end = p + size;
+  while (p < end) {
+    const char *line = p;
+    const char *eol = nextLine(p, end);
+    p = eol;
+    const char *sep = (const char *) memchr(line, ' ', eol - line);
+    if (!sep) {
+      continue;
+    }
+    int32_t i = this->lookup(line, sep);
+    if (i < 0) {
+      continue;
+    }
+    const char *cp = sep;
+    if (scanU64(cp, eol, &_values[i])) {
+      _found[i] = 1;
+    }
+  }
+
+  uint64_t nowMs = uv_hrtime() / 1000000;
+  float seconds = (nowMs - _lastReadMs) / 1000.0f;
+  for (size_t i = 0; i < _names.size(); ++i) {
+    // counters may be reset by writing to some sysctls
+    if (_lastReadMs != 0 && nowMs > _lastReadMs &&
+        _values[i] >= _lastValues[i]) {
+      _rates[i] = (_values[i] - _lastValues[i]) / seconds;
+    } else {
+      _rates[i] = 0.0f;
+    }
+    _lastValues[i] = _values[i];
+  }
+  _lastReadMs = nowMs;
+  return 0;
+}
+
+YODA_NS_END
@@ -0,0 +1,65 @@
+//
+// Created by ximin.chen@rokid.com on 2026/10/17.
+//
+
+#ifndef YODA_SIXSIX_VMSTAT_H
+#define YODA_SIXSIX_VMSTAT_H
+
+#include "def.h"
+
+YODA_NS_BEGIN
+
+/*
+ * Reads a chosen set of /proc/vmstat counters and their per second rates.
+ *
+ * The names are looked up with a perfect hash built in the constructor: the
+ * hash seed is searched until no two names share a slot, so a line of the
+ * file costs one hash and at most one compare.
+ */
+class VmstatReader {
+public:
+  VmstatReader(const std::string &path, const std::vector<std::string> &names);
+
+  ~VmstatReader();
+
+  /*
+   * read and parse the file, returns 0 on success
+   */
+  int32_t read();
+
+  const std::vector<std::string> &names() const { return _names; }
+
+  /*
+   * false if the counter was not in the last read
+   */
+  bool found(size_t i) const { return _found[i] != 0; }
+
+  uint64_t value(size_t i) const { return _values[i]; }
+
+  /*
+   * increase per second since the read before the last one
+   */
+  float rate(size_t i) const { return _rates[i]; }
+
+private:
+  void buildIndex();
+
+  int32_t lookup(const char *key, const char *end) const;
+
+  std::string _path;
+  int _fd;
+  std::vector<char> _buf;
+  std::vector<std::string> _names;
+  std::vector<int32_t> _slots;
+  uint32_t _seed;
+  uint32_t _mask;
+  std::vector<uint8_t> _found;
+  std::vector<uint64_t> _values;
+  std::vector<uint64_t> _lastValues;
+  std::vector<float> _rates;
+  uint64_t _lastReadMs;
+};
+
+YODA_NS_END
+
+#endif //YODA_SIXSIX_VMSTAT_H
@@ -23,7 +23,15 @@ typedef enum class JobType {
   COLLECT_SMAP = 1,
   SPAWN_CHILD = 2,
   CRASH_REPORTER = 3,
-  COLLECT_BATTERY = 4
+  COLLECT_BATTERY = 4,
+  COLLECT_PRESSURE = 5,
+  COLLECT_VMSTAT = 6,
+  COLLECT_DISK_STATS = 7,
+  COLLECT_NET_DEV = 8,
+  COLLECT_CGROUP = 9,
+  COLLECT_THERMAL = 10,
+  COLLECT_CPU_FREQ = 11,
+  COLLECT_INTERRUPTS = 12
 } JobType;
 
 typedef enum class JobState {
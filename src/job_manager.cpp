@@ -230,8 +230,8 @@ void JobManager::startMonitor() {
   smapConf->isRepeat = true;
   smapConf->loopCount = 0;
   smapConf->timeout = 1000;
-  smapConf->interval = Options::get<uint64_t>("smapInterval", 300 * 1000);
-  LOG_INFO("smap interval %" PRIu64 "ms", smapConf->interval);
+  // CollectSmap skips the runs within its own default interval
+  smapConf->interval = Options::get<uint64_t>("smapInterval", 5000);
   _runners.push_back(this->addRunnerWithConf(smapConf));
 
   std::shared_ptr<JobConf> crashReporterConf(new JobConf);
@@ -251,6 +251,94 @@ void JobManager::startMonitor() {
   batteryConf->timeout = 3000;
   batteryConf->interval = 3000;
   _runners.push_back(this->addRunnerWithConf(batteryConf));
+
+  std::shared_ptr<JobConf> pressureConf(new JobConf);
+  pressureConf->type = JobType::COLLECT_PRESSURE;
+  pressureConf->enable = Options::get<uint32_t>("pressureEnable", 0) != 0;
+  pressureConf->isRepeat = true;
+  pressureConf->loopCount = 0;
+  pressureConf->timeout = 1000;
+  pressureConf->interval = Options::get<uint64_t>("pressureInterval", 2000);
+  if (pressureConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(pressureConf));
+  }
+
+  std::shared_ptr<JobConf> vmstatConf(new JobConf);
+  vmstatConf->type = JobType::COLLECT_VMSTAT;
+  vmstatConf->enable = Options::get<uint32_t>("vmstatEnable", 0) != 0;
+  vmstatConf->isRepeat = true;
+  vmstatConf->loopCount = 0;
+  vmstatConf->timeout = 1000;
+  vmstatConf->interval = Options::get<uint64_t>("vmstatInterval", 5000);
+  if (vmstatConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(vmstatConf));
+  }
+
+  std::shared_ptr<JobConf> diskConf(new JobConf);
+  diskConf->type = JobType::COLLECT_DISK_STATS;
+  diskConf->enable = Options::get<uint32_t>("diskStatsEnable", 0) != 0;
+  diskConf->isRepeat = true;
+  diskConf->loopCount = 0;
+  diskConf->timeout = 1000;
+  diskConf->interval = Options::get<uint64_t>("diskStatsInterval", 3000);
+  if (diskConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(diskConf));
+  }
+
+  std::shared_ptr<JobConf> netDevConf(new JobConf);
+  netDevConf->type = JobType::COLLECT_NET_DEV;
+  netDevConf->enable = Options::get<uint32_t>("netDevEnable", 0) != 0;
+  netDevConf->isRepeat = true;
+  netDevConf->loopCount = 0;
+  netDevConf->timeout = 1000;
+  netDevConf->interval = Options::get<uint64_t>("netDevInterval", 3000);
+  if (netDevConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(netDevConf));
+  }
+
+  std::shared_ptr<JobConf> cgroupConf(new JobConf);
+  cgroupConf->type = JobType::COLLECT_CGROUP;
+  cgroupConf->enable = Options::get<uint32_t>("cgroupEnable", 0) != 0;
+  cgroupConf->isRepeat = true;
+  cgroupConf->loopCount = 0;
+  cgroupConf->timeout = 1000;
+  cgroupConf->interval = Options::get<uint64_t>("cgroupInterval", 5000);
+  if (cgroupConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(cgroupConf));
+  }
+
+  std::shared_ptr<JobConf> thermalConf(new JobConf);
+  thermalConf->type = JobType::COLLECT_THERMAL;
+  thermalConf->enable = Options::get<uint32_t>("thermalEnable", 0) != 0;
+  thermalConf->isRepeat = true;
+  thermalConf->loopCount = 0;
+  thermalConf->timeout = 1000;
+  thermalConf->interval = Options::get<uint64_t>("thermalInterval", 3000);
+  if (thermalConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(thermalConf));
+  }
+
+  std::shared_ptr<JobConf> cpuFreqConf(new JobConf);
+  cpuFreqConf->type = JobType::COLLECT_CPU_FREQ;
+  cpuFreqConf->enable = Options::get<uint32_t>("cpuFreqEnable", 0) != 0;
+  cpuFreqConf->isRepeat = true;
+  cpuFreqConf->loopCount = 0;
+  cpuFreqConf->timeout = 1000;
+  cpuFreqConf->interval = Options::get<uint64_t>("cpuFreqInterval", 5000);
+  if (cpuFreqConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(cpuFreqConf));
+  }
+
+  std::shared_ptr<JobConf> irqConf(new JobConf);
+  irqConf->type = JobType::COLLECT_INTERRUPTS;
+  irqConf->enable = Options::get<uint32_t>("irqEnable", 0) != 0;
+  irqConf->isRepeat = true;
+  irqConf->loopCount = 0;
+  irqConf->timeout = 1000;
+  irqConf->interval = Options::get<uint64_t>("irqInterval", 3000);
+  if (irqConf->enable) {
+    _runners.push_back(this->addRunnerWithConf(irqConf));
+  }
 }
 
 void JobManager::stopMonitor() {
@@ -9,6 +9,14 @@
 #include "child_process.h"
 #include "crash_reporter.h"
 #include "collect_battery.h"
+#include "collect_pressure.h"
+#include "collect_vmstat.h"
+#include "collect_disk_stats.h"
+#include "collect_net_dev.h"
+#include "collect_cgroup.h"
+#include "collect_thermal.h"
+#include "collect_cpu_freq.h"
+#include "collect_interrupts.h"
 
 YODA_NS_BEGIN
 
@@ -48,6 +56,30 @@ int JobRunner::initWithConf(const std::shared_ptr<JobConf> &conf) {
     case JobType::COLLECT_BATTERY:
       _executor = std::shared_ptr<IJobExecutor>(new CollectBattery());
       break;
+    case JobType::COLLECT_PRESSURE:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectPressure());
+      break;
+    case JobType::COLLECT_VMSTAT:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectVmstat());
+      break;
+    case JobType::COLLECT_DISK_STATS:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectDiskStats());
+      break;
+    case JobType::COLLECT_NET_DEV:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectNetDev());
+      break;
+    case JobType::COLLECT_CGROUP:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectCgroup());
+      break;
+    case JobType::COLLECT_THERMAL:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectThermal());
+      break;
+    case JobType::COLLECT_CPU_FREQ:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectCpuFreq());
+      break;
+    case JobType::COLLECT_INTERRUPTS:
+      _executor = std::shared_ptr<IJobExecutor>(new CollectInterrupts());
+      break;
     default:
       ASSERT(0, "unknown job type %d", conf->type);
   }
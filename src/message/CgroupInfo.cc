@@ -0,0 +1,202 @@
+#include "CgroupInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CgroupInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CGROUPINFO));
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstCpuUsage = caps->write((float)cpuUsage);
+  if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstThrottledMs = caps->write((float)throttledMs);
+  if (wRstThrottledMs != CAPS_SUCCESS) return wRstThrottledMs;
+  int32_t wRstCpuSomeAvg10 = caps->write((float)cpuSomeAvg10);
+  if (wRstCpuSomeAvg10 != CAPS_SUCCESS) return wRstCpuSomeAvg10;
+  int32_t wRstMemoryCurrent = caps->write((uint64_t)memoryCurrent);
+  if (wRstMemoryCurrent != CAPS_SUCCESS) return wRstMemoryCurrent;
+  int32_t wRstMemoryAnon = caps->write((uint64_t)memoryAnon);
+  if (wRstMemoryAnon != CAPS_SUCCESS) return wRstMemoryAnon;
+  int32_t wRstMemoryFile = caps->write((uint64_t)memoryFile);
+  if (wRstMemoryFile != CAPS_SUCCESS) return wRstMemoryFile;
+  int32_t wRstPgmajfaultRate = caps->write((float)pgmajfaultRate);
+  if (wRstPgmajfaultRate != CAPS_SUCCESS) return wRstPgmajfaultRate;
+  int32_t wRstIoReadBytes = caps->write((float)ioReadBytes);
+  if (wRstIoReadBytes != CAPS_SUCCESS) return wRstIoReadBytes;
+  int32_t wRstIoWriteBytes = caps->write((float)ioWriteBytes);
+  if (wRstIoWriteBytes != CAPS_SUCCESS) return wRstIoWriteBytes;
+  int32_t wRstIoReadOps = caps->write((float)ioReadOps);
+  if (wRstIoReadOps != CAPS_SUCCESS) return wRstIoReadOps;
+  int32_t wRstIoWriteOps = caps->write((float)ioWriteOps);
+  if (wRstIoWriteOps != CAPS_SUCCESS) return wRstIoWriteOps;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CgroupInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CGROUPINFO));
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstCpuUsage = caps->write((float)cpuUsage);
+  if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstThrottledMs = caps->write((float)throttledMs);
+  if (wRstThrottledMs != CAPS_SUCCESS) return wRstThrottledMs;
+  int32_t wRstCpuSomeAvg10 = caps->write((float)cpuSomeAvg10);
+  if (wRstCpuSomeAvg10 != CAPS_SUCCESS) return wRstCpuSomeAvg10;
+  int32_t wRstMemoryCurrent = caps->write((uint64_t)memoryCurrent);
+  if (wRstMemoryCurrent != CAPS_SUCCESS) return wRstMemoryCurrent;
+  int32_t wRstMemoryAnon = caps->write((uint64_t)memoryAnon);
+  if (wRstMemoryAnon != CAPS_SUCCESS) return wRstMemoryAnon;
+  int32_t wRstMemoryFile = caps->write((uint64_t)memoryFile);
+  if (wRstMemoryFile != CAPS_SUCCESS) return wRstMemoryFile;
+  int32_t wRstPgmajfaultRate = caps->write((float)pgmajfaultRate);
+  if (wRstPgmajfaultRate != CAPS_SUCCESS) return wRstPgmajfaultRate;
+  int32_t wRstIoReadBytes = caps->write((float)ioReadBytes);
+  if (wRstIoReadBytes != CAPS_SUCCESS) return wRstIoReadBytes;
+  int32_t wRstIoWriteBytes = caps->write((float)ioWriteBytes);
+  if (wRstIoWriteBytes != CAPS_SUCCESS) return wRstIoWriteBytes;
+  int32_t wRstIoReadOps = caps->write((float)ioReadOps);
+  if (wRstIoReadOps != CAPS_SUCCESS) return wRstIoReadOps;
+  int32_t wRstIoWriteOps = caps->write((float)ioWriteOps);
+  if (wRstIoWriteOps != CAPS_SUCCESS) return wRstIoWriteOps;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CgroupInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstCpuUsage = caps->read(cpuUsage);
+  if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstThrottledMs = caps->read(throttledMs);
+  if (rRstThrottledMs != CAPS_SUCCESS) return rRstThrottledMs;
+  int32_t rRstCpuSomeAvg10 = caps->read(cpuSomeAvg10);
+  if (rRstCpuSomeAvg10 != CAPS_SUCCESS) return rRstCpuSomeAvg10;
+  int32_t rRstMemoryCurrent = caps->read(memoryCurrent);
+  if (rRstMemoryCurrent != CAPS_SUCCESS) return rRstMemoryCurrent;
+  int32_t rRstMemoryAnon = caps->read(memoryAnon);
+  if (rRstMemoryAnon != CAPS_SUCCESS) return rRstMemoryAnon;
+  int32_t rRstMemoryFile = caps->read(memoryFile);
+  if (rRstMemoryFile != CAPS_SUCCESS) return rRstMemoryFile;
+  int32_t rRstPgmajfaultRate = caps->read(pgmajfaultRate);
+  if (rRstPgmajfaultRate != CAPS_SUCCESS) return rRstPgmajfaultRate;
+  int32_t rRstIoReadBytes = caps->read(ioReadBytes);
+  if (rRstIoReadBytes != CAPS_SUCCESS) return rRstIoReadBytes;
+  int32_t rRstIoWriteBytes = caps->read(ioWriteBytes);
+  if (rRstIoWriteBytes != CAPS_SUCCESS) return rRstIoWriteBytes;
+  int32_t rRstIoReadOps = caps->read(ioReadOps);
+  if (rRstIoReadOps != CAPS_SUCCESS) return rRstIoReadOps;
+  int32_t rRstIoWriteOps = caps->read(ioWriteOps);
+  if (rRstIoWriteOps != CAPS_SUCCESS) return rRstIoWriteOps;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CgroupInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstCpuUsage = caps->read(cpuUsage);
+  if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstThrottledMs = caps->read(throttledMs);
+  if (rRstThrottledMs != CAPS_SUCCESS) return rRstThrottledMs;
+  int32_t rRstCpuSomeAvg10 = caps->read(cpuSomeAvg10);
+  if (rRstCpuSomeAvg10 != CAPS_SUCCESS) return rRstCpuSomeAvg10;
+  int32_t rRstMemoryCurrent = caps->read(memoryCurrent);
+  if (rRstMemoryCurrent != CAPS_SUCCESS) return rRstMemoryCurrent;
+  int32_t rRstMemoryAnon = caps->read(memoryAnon);
+  if (rRstMemoryAnon != CAPS_SUCCESS) return rRstMemoryAnon;
+  int32_t rRstMemoryFile = caps->read(memoryFile);
+  if (rRstMemoryFile != CAPS_SUCCESS) return rRstMemoryFile;
+  int32_t rRstPgmajfaultRate = caps->read(pgmajfaultRate);
+  if (rRstPgmajfaultRate != CAPS_SUCCESS) return rRstPgmajfaultRate;
+  int32_t rRstIoReadBytes = caps->read(ioReadBytes);
+  if (rRstIoReadBytes != CAPS_SUCCESS) return rRstIoReadBytes;
+  int32_t rRstIoWriteBytes = caps->read(ioWriteBytes);
+  if (rRstIoWriteBytes != CAPS_SUCCESS) return rRstIoWriteBytes;
+  int32_t rRstIoReadOps = caps->read(ioReadOps);
+  if (rRstIoReadOps != CAPS_SUCCESS) return rRstIoReadOps;
+  int32_t rRstIoWriteOps = caps->read(ioWriteOps);
+  if (rRstIoWriteOps != CAPS_SUCCESS) return rRstIoWriteOps;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CgroupInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstCpuUsage = caps->write((float)cpuUsage);
+  if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstThrottledMs = caps->write((float)throttledMs);
+  if (wRstThrottledMs != CAPS_SUCCESS) return wRstThrottledMs;
+  int32_t wRstCpuSomeAvg10 = caps->write((float)cpuSomeAvg10);
+  if (wRstCpuSomeAvg10 != CAPS_SUCCESS) return wRstCpuSomeAvg10;
+  int32_t wRstMemoryCurrent = caps->write((uint64_t)memoryCurrent);
+  if (wRstMemoryCurrent != CAPS_SUCCESS) return wRstMemoryCurrent;
+  int32_t wRstMemoryAnon = caps->write((uint64_t)memoryAnon);
+  if (wRstMemoryAnon != CAPS_SUCCESS) return wRstMemoryAnon;
+  int32_t wRstMemoryFile = caps->write((uint64_t)memoryFile);
+  if (wRstMemoryFile != CAPS_SUCCESS) return wRstMemoryFile;
+  int32_t wRstPgmajfaultRate = caps->write((float)pgmajfaultRate);
+  if (wRstPgmajfaultRate != CAPS_SUCCESS) return wRstPgmajfaultRate;
+  int32_t wRstIoReadBytes = caps->write((float)ioReadBytes);
+  if (wRstIoReadBytes != CAPS_SUCCESS) return wRstIoReadBytes;
+  int32_t wRstIoWriteBytes = caps->write((float)ioWriteBytes);
+  if (wRstIoWriteBytes != CAPS_SUCCESS) return wRstIoWriteBytes;
+  int32_t wRstIoReadOps = caps->write((float)ioReadOps);
+  if (wRstIoReadOps != CAPS_SUCCESS) return wRstIoReadOps;
+  int32_t wRstIoWriteOps = caps->write((float)ioWriteOps);
+  if (wRstIoWriteOps != CAPS_SUCCESS) return wRstIoWriteOps;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CgroupInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstCpuUsage = caps->read(cpuUsage);
+  if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstThrottledMs = caps->read(throttledMs);
+  if (rRstThrottledMs != CAPS_SUCCESS) return rRstThrottledMs;
+  int32_t rRstCpuSomeAvg10 = caps->read(cpuSomeAvg10);
+  if (rRstCpuSomeAvg10 != CAPS_SUCCESS) return rRstCpuSomeAvg10;
+  int32_t rRstMemoryCurrent = caps->read(memoryCurrent);
+  if (rRstMemoryCurrent != CAPS_SUCCESS) return rRstMemoryCurrent;
+  int32_t rRstMemoryAnon = caps->read(memoryAnon);
+  if (rRstMemoryAnon != CAPS_SUCCESS) return rRstMemoryAnon;
+  int32_t rRstMemoryFile = caps->read(memoryFile);
+  if (rRstMemoryFile != CAPS_SUCCESS) return rRstMemoryFile;
+  int32_t rRstPgmajfaultRate = caps->read(pgmajfaultRate);
+  if (rRstPgmajfaultRate != CAPS_SUCCESS) return rRstPgmajfaultRate;
+  int32_t rRstIoReadBytes = caps->read(ioReadBytes);
+  if (rRstIoReadBytes != CAPS_SUCCESS) return rRstIoReadBytes;
+  int32_t rRstIoWriteBytes = caps->read(ioWriteBytes);
+  if (rRstIoWriteBytes != CAPS_SUCCESS) return rRstIoWriteBytes;
+  int32_t rRstIoReadOps = caps->read(ioReadOps);
+  if (rRstIoReadOps != CAPS_SUCCESS) return rRstIoReadOps;
+  int32_t rRstIoWriteOps = caps->read(ioWriteOps);
+  if (rRstIoWriteOps != CAPS_SUCCESS) return rRstIoWriteOps;
+  return CAPS_SUCCESS;
+}
+
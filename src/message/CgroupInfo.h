@@ -0,0 +1,207 @@
+#ifndef _CGROUPINFO_H
+#define _CGROUPINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * usage of one cgroup v2 group
+   */
+  class CgroupInfo {
+  private:
+    std::shared_ptr<std::string> path = nullptr;
+    float cpuUsage = 0;
+    float throttledMs = 0;
+    float cpuSomeAvg10 = 0;
+    uint64_t memoryCurrent = 0;
+    uint64_t memoryAnon = 0;
+    uint64_t memoryFile = 0;
+    float pgmajfaultRate = 0;
+    float ioReadBytes = 0;
+    float ioWriteBytes = 0;
+    float ioReadOps = 0;
+    float ioWriteOps = 0;
+  public:
+    inline static std::shared_ptr<CgroupInfo> create() {
+      return std::make_shared<CgroupInfo>();
+    }
+    /*
+    * getter path relative to the cgroup root
+    */
+    inline const std::shared_ptr<std::string> getPath() const {
+      return path;
+    }
+    /*
+    * getter cpu usage percent of one core
+    */
+    inline float getCpuUsage() const {
+      return cpuUsage;
+    }
+    /*
+    * getter milliseconds throttled by cpu.max in the interval
+    */
+    inline float getThrottledMs() const {
+      return throttledMs;
+    }
+    /*
+    * getter cpu.pressure some avg10
+    */
+    inline float getCpuSomeAvg10() const {
+      return cpuSomeAvg10;
+    }
+    /*
+    * getter memory.current in bytes
+    */
+    inline uint64_t getMemoryCurrent() const {
+      return memoryCurrent;
+    }
+    /*
+    * getter anon bytes of memory.stat
+    */
+    inline uint64_t getMemoryAnon() const {
+      return memoryAnon;
+    }
+    /*
+    * getter file bytes of memory.stat
+    */
+    inline uint64_t getMemoryFile() const {
+      return memoryFile;
+    }
+    /*
+    * getter major faults per second
+    */
+    inline float getPgmajfaultRate() const {
+      return pgmajfaultRate;
+    }
+    /*
+    * getter bytes read per second of all devices
+    */
+    inline float getIoReadBytes() const {
+      return ioReadBytes;
+    }
+    /*
+    * getter bytes written per second of all devices
+    */
+    inline float getIoWriteBytes() const {
+      return ioWriteBytes;
+    }
+    /*
+    * getter reads per second of all devices
+    */
+    inline float getIoReadOps() const {
+      return ioReadOps;
+    }
+    /*
+    * getter writes per second of all devices
+    */
+    inline float getIoWriteOps() const {
+      return ioWriteOps;
+    }
+    /*
+    * setter path relative to the cgroup root
+    */
+    inline void setPath(const std::shared_ptr<std::string> &v) {
+      path = v;
+    }
+    /*
+    * setter path relative to the cgroup root
+    */
+    inline void setPath(const char* v) {
+      if (!path) path = std::make_shared<std::string>();
+      *path = v;
+    }
+    /*
+    * setter cpu usage percent of one core
+    */
+    inline void setCpuUsage(float v) {
+      cpuUsage = v;
+    }
+    /*
+    * setter milliseconds throttled by cpu.max in the interval
+    */
+    inline void setThrottledMs(float v) {
+      throttledMs = v;
+    }
+    /*
+    * setter cpu.pressure some avg10
+    */
+    inline void setCpuSomeAvg10(float v) {
+      cpuSomeAvg10 = v;
+    }
+    /*
+    * setter memory.current in bytes
+    */
+    inline void setMemoryCurrent(uint64_t v) {
+      memoryCurrent = v;
+    }
+    /*
+    * setter anon bytes of memory.stat
+    */
+    inline void setMemoryAnon(uint64_t v) {
+      memoryAnon = v;
+    }
+    /*
+    * setter file bytes of memory.stat
+    */
+    inline void setMemoryFile(uint64_t v) {
+      memoryFile = v;
+    }
+    /*
+    * setter major faults per second
+    */
+    inline void setPgmajfaultRate(float v) {
+      pgmajfaultRate = v;
+    }
+    /*
+    * setter bytes read per second of all devices
+    */
+    inline void setIoReadBytes(float v) {
+      ioReadBytes = v;
+    }
+    /*
+    * setter bytes written per second of all devices
+    */
+    inline void setIoWriteBytes(float v) {
+      ioWriteBytes = v;
+    }
+    /*
+    * setter reads per second of all devices
+    */
+    inline void setIoReadOps(float v) {
+      ioReadOps = v;
+    }
+    /*
+    * setter writes per second of all devices
+    */
+    inline void setIoWriteOps(float v) {
+      ioWriteOps = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CGROUPINFO_H
\ No newline at end of file
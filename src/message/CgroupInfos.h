@@ -0,0 +1,71 @@
+#ifndef _CGROUPINFOS_H
+#define _CGROUPINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "CgroupInfo.h"
+namespace rokid {
+  /*
+   * cgroup v2 usage of the configured subtree
+   */
+  class CgroupInfos {
+  private:
+    std::shared_ptr<std::vector<CgroupInfo>> cgroups = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<CgroupInfos> create() {
+      return std::make_shared<CgroupInfos>();
+    }
+    /*
+    * getter cgroups of the subtree
+    */
+    inline const std::shared_ptr<std::vector<CgroupInfo>> getCgroups() const {
+      return cgroups;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter cgroups of the subtree
+    */
+    inline void setCgroups(const std::shared_ptr<std::vector<CgroupInfo>> &v) {
+      this->cgroups = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CGROUPINFOS_H
\ No newline at end of file
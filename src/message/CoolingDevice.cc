@@ -0,0 +1,115 @@
+#include "CoolingDevice.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CoolingDevice::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_COOLINGDEVICE));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstCurState = caps->write((int32_t)curState);
+  if (wRstCurState != CAPS_SUCCESS) return wRstCurState;
+  int32_t wRstMaxState = caps->write((int32_t)maxState);
+  if (wRstMaxState != CAPS_SUCCESS) return wRstMaxState;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CoolingDevice::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_COOLINGDEVICE));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstCurState = caps->write((int32_t)curState);
+  if (wRstCurState != CAPS_SUCCESS) return wRstCurState;
+  int32_t wRstMaxState = caps->write((int32_t)maxState);
+  if (wRstMaxState != CAPS_SUCCESS) return wRstMaxState;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CoolingDevice::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstCurState = caps->read(curState);
+  if (rRstCurState != CAPS_SUCCESS) return rRstCurState;
+  int32_t rRstMaxState = caps->read(maxState);
+  if (rRstMaxState != CAPS_SUCCESS) return rRstMaxState;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CoolingDevice::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstCurState = caps->read(curState);
+  if (rRstCurState != CAPS_SUCCESS) return rRstCurState;
+  int32_t rRstMaxState = caps->read(maxState);
+  if (rRstMaxState != CAPS_SUCCESS) return rRstMaxState;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CoolingDevice::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstCurState = caps->write((int32_t)curState);
+  if (wRstCurState != CAPS_SUCCESS) return wRstCurState;
+  int32_t wRstMaxState = caps->write((int32_t)maxState);
+  if (wRstMaxState != CAPS_SUCCESS) return wRstMaxState;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CoolingDevice::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstCurState = caps->read(curState);
+  if (rRstCurState != CAPS_SUCCESS) return rRstCurState;
+  int32_t rRstMaxState = caps->read(maxState);
+  if (rRstMaxState != CAPS_SUCCESS) return rRstMaxState;
+  return CAPS_SUCCESS;
+}
+
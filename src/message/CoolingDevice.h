@@ -0,0 +1,110 @@
+#ifndef _COOLINGDEVICE_H
+#define _COOLINGDEVICE_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * one cooling device of /sys/class/thermal
+   */
+  class CoolingDevice {
+  private:
+    std::shared_ptr<std::string> name = nullptr;
+    std::shared_ptr<std::string> type = nullptr;
+    int32_t curState = 0;
+    int32_t maxState = 0;
+  public:
+    inline static std::shared_ptr<CoolingDevice> create() {
+      return std::make_shared<CoolingDevice>();
+    }
+    /*
+    * getter device directory, e.g. cooling_device0
+    */
+    inline const std::shared_ptr<std::string> getName() const {
+      return name;
+    }
+    /*
+    * getter device type, e.g. cpufreq-cpu0
+    */
+    inline const std::shared_ptr<std::string> getType() const {
+      return type;
+    }
+    /*
+    * getter current cooling state, 0 is not throttled
+    */
+    inline int32_t getCurState() const {
+      return curState;
+    }
+    /*
+    * getter highest cooling state
+    */
+    inline int32_t getMaxState() const {
+      return maxState;
+    }
+    /*
+    * setter device directory, e.g. cooling_device0
+    */
+    inline void setName(const std::shared_ptr<std::string> &v) {
+      name = v;
+    }
+    /*
+    * setter device directory, e.g. cooling_device0
+    */
+    inline void setName(const char* v) {
+      if (!name) name = std::make_shared<std::string>();
+      *name = v;
+    }
+    /*
+    * setter device type, e.g. cpufreq-cpu0
+    */
+    inline void setType(const std::shared_ptr<std::string> &v) {
+      type = v;
+    }
+    /*
+    * setter device type, e.g. cpufreq-cpu0
+    */
+    inline void setType(const char* v) {
+      if (!type) type = std::make_shared<std::string>();
+      *type = v;
+    }
+    /*
+    * setter current cooling state, 0 is not throttled
+    */
+    inline void setCurState(int32_t v) {
+      curState = v;
+    }
+    /*
+    * setter highest cooling state
+    */
+    inline void setMaxState(int32_t v) {
+      maxState = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _COOLINGDEVICE_H
\ No newline at end of file
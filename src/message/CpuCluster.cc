@@ -0,0 +1,106 @@
+#include "CpuCluster.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CpuCluster::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUCLUSTER));
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCpus;
+  assert(cpus);
+  wRstCpus = caps->write(cpus->c_str());
+  if (wRstCpus != CAPS_SUCCESS) return wRstCpus;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CpuCluster::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUCLUSTER));
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCpus;
+  assert(cpus);
+  wRstCpus = caps->write(cpus->c_str());
+  if (wRstCpus != CAPS_SUCCESS) return wRstCpus;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CpuCluster::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  if (!cpus) cpus = std::make_shared<std::string>();
+  int32_t rRstCpus = caps->read_string(*cpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CpuCluster::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  if (!cpus) cpus = std::make_shared<std::string>();
+  int32_t rRstCpus = caps->read_string(*cpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CpuCluster::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCpus;
+  assert(cpus);
+  wRstCpus = caps->write(cpus->c_str());
+  if (wRstCpus != CAPS_SUCCESS) return wRstCpus;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CpuCluster::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  if (!cpus) cpus = std::make_shared<std::string>();
+  int32_t rRstCpus = caps->read_string(*cpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  return CAPS_SUCCESS;
+}
+
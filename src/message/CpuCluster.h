@@ -0,0 +1,103 @@
+#ifndef _CPUCLUSTER_H
+#define _CPUCLUSTER_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * cpus sharing one cluster id
+   */
+  class CpuCluster {
+  private:
+    int32_t cluster = 0;
+    std::shared_ptr<std::string> cpus = nullptr;
+    int32_t avgFreq = 0;
+    int32_t maxFreq = 0;
+  public:
+    inline static std::shared_ptr<CpuCluster> create() {
+      return std::make_shared<CpuCluster>();
+    }
+    /*
+    * getter cluster id
+    */
+    inline int32_t getCluster() const {
+      return cluster;
+    }
+    /*
+    * getter cpu ids, e.g. 0,1,2,3
+    */
+    inline const std::shared_ptr<std::string> getCpus() const {
+      return cpus;
+    }
+    /*
+    * getter average frequency of the cpus in kHz
+    */
+    inline int32_t getAvgFreq() const {
+      return avgFreq;
+    }
+    /*
+    * getter highest cpuinfo_max_freq of the cpus in kHz
+    */
+    inline int32_t getMaxFreq() const {
+      return maxFreq;
+    }
+    /*
+    * setter cluster id
+    */
+    inline void setCluster(int32_t v) {
+      cluster = v;
+    }
+    /*
+    * setter cpu ids, e.g. 0,1,2,3
+    */
+    inline void setCpus(const std::shared_ptr<std::string> &v) {
+      cpus = v;
+    }
+    /*
+    * setter cpu ids, e.g. 0,1,2,3
+    */
+    inline void setCpus(const char* v) {
+      if (!cpus) cpus = std::make_shared<std::string>();
+      *cpus = v;
+    }
+    /*
+    * setter average frequency of the cpus in kHz
+    */
+    inline void setAvgFreq(int32_t v) {
+      avgFreq = v;
+    }
+    /*
+    * setter highest cpuinfo_max_freq of the cpus in kHz
+    */
+    inline void setMaxFreq(int32_t v) {
+      maxFreq = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CPUCLUSTER_H
\ No newline at end of file
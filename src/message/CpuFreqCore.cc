@@ -0,0 +1,301 @@
+#include "CpuFreqCore.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CpuFreqCore::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQCORE));
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCapacity = caps->write((int32_t)capacity);
+  if (wRstCapacity != CAPS_SUCCESS) return wRstCapacity;
+  int32_t wRstCurFreq = caps->write((int32_t)curFreq);
+  if (wRstCurFreq != CAPS_SUCCESS) return wRstCurFreq;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  if (!freqResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)freqResidency->size());
+    for(auto &v : *freqResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!idleResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)idleResidency->size());
+    for(auto &v : *idleResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CpuFreqCore::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQCORE));
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCapacity = caps->write((int32_t)capacity);
+  if (wRstCapacity != CAPS_SUCCESS) return wRstCapacity;
+  int32_t wRstCurFreq = caps->write((int32_t)curFreq);
+  if (wRstCurFreq != CAPS_SUCCESS) return wRstCurFreq;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  if (!freqResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)freqResidency->size());
+    for(auto &v : *freqResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!idleResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)idleResidency->size());
+    for(auto &v : *idleResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CpuFreqCore::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  int32_t rRstCapacity = caps->read(capacity);
+  if (rRstCapacity != CAPS_SUCCESS) return rRstCapacity;
+  int32_t rRstCurFreq = caps->read(curFreq);
+  if (rRstCurFreq != CAPS_SUCCESS) return rRstCurFreq;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  int32_t arraySizeFreqResidency = 0;
+  int32_t rRstFreqResidency = caps->read(arraySizeFreqResidency);
+  if (rRstFreqResidency != CAPS_SUCCESS) return rRstFreqResidency;
+  if (!freqResidency)
+    freqResidency = std::make_shared<std::vector<CpuFreqResidency>>();
+  else
+    freqResidency->clear();
+  for(int32_t i = 0; i < arraySizeFreqResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      freqResidency->emplace_back();
+      int32_t dRst = freqResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeIdleResidency = 0;
+  int32_t rRstIdleResidency = caps->read(arraySizeIdleResidency);
+  if (rRstIdleResidency != CAPS_SUCCESS) return rRstIdleResidency;
+  if (!idleResidency)
+    idleResidency = std::make_shared<std::vector<CpuIdleResidency>>();
+  else
+    idleResidency->clear();
+  for(int32_t i = 0; i < arraySizeIdleResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      idleResidency->emplace_back();
+      int32_t dRst = idleResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CpuFreqCore::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  int32_t rRstCapacity = caps->read(capacity);
+  if (rRstCapacity != CAPS_SUCCESS) return rRstCapacity;
+  int32_t rRstCurFreq = caps->read(curFreq);
+  if (rRstCurFreq != CAPS_SUCCESS) return rRstCurFreq;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  int32_t arraySizeFreqResidency = 0;
+  int32_t rRstFreqResidency = caps->read(arraySizeFreqResidency);
+  if (rRstFreqResidency != CAPS_SUCCESS) return rRstFreqResidency;
+  if (!freqResidency)
+    freqResidency = std::make_shared<std::vector<CpuFreqResidency>>();
+  else
+    freqResidency->clear();
+  for(int32_t i = 0; i < arraySizeFreqResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      freqResidency->emplace_back();
+      int32_t dRst = freqResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeIdleResidency = 0;
+  int32_t rRstIdleResidency = caps->read(arraySizeIdleResidency);
+  if (rRstIdleResidency != CAPS_SUCCESS) return rRstIdleResidency;
+  if (!idleResidency)
+    idleResidency = std::make_shared<std::vector<CpuIdleResidency>>();
+  else
+    idleResidency->clear();
+  for(int32_t i = 0; i < arraySizeIdleResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      idleResidency->emplace_back();
+      int32_t dRst = idleResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CpuFreqCore::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstCluster = caps->write((int32_t)cluster);
+  if (wRstCluster != CAPS_SUCCESS) return wRstCluster;
+  int32_t wRstCapacity = caps->write((int32_t)capacity);
+  if (wRstCapacity != CAPS_SUCCESS) return wRstCapacity;
+  int32_t wRstCurFreq = caps->write((int32_t)curFreq);
+  if (wRstCurFreq != CAPS_SUCCESS) return wRstCurFreq;
+  int32_t wRstAvgFreq = caps->write((int32_t)avgFreq);
+  if (wRstAvgFreq != CAPS_SUCCESS) return wRstAvgFreq;
+  int32_t wRstMaxFreq = caps->write((int32_t)maxFreq);
+  if (wRstMaxFreq != CAPS_SUCCESS) return wRstMaxFreq;
+  if (!freqResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)freqResidency->size());
+    for(auto &v : *freqResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!idleResidency)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)idleResidency->size());
+    for(auto &v : *idleResidency) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CpuFreqCore::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstCluster = caps->read(cluster);
+  if (rRstCluster != CAPS_SUCCESS) return rRstCluster;
+  int32_t rRstCapacity = caps->read(capacity);
+  if (rRstCapacity != CAPS_SUCCESS) return rRstCapacity;
+  int32_t rRstCurFreq = caps->read(curFreq);
+  if (rRstCurFreq != CAPS_SUCCESS) return rRstCurFreq;
+  int32_t rRstAvgFreq = caps->read(avgFreq);
+  if (rRstAvgFreq != CAPS_SUCCESS) return rRstAvgFreq;
+  int32_t rRstMaxFreq = caps->read(maxFreq);
+  if (rRstMaxFreq != CAPS_SUCCESS) return rRstMaxFreq;
+  int32_t arraySizeFreqResidency = 0;
+  int32_t rRstFreqResidency = caps->read(arraySizeFreqResidency);
+  if (rRstFreqResidency != CAPS_SUCCESS) return rRstFreqResidency;
+  if (!freqResidency)
+    freqResidency = std::make_shared<std::vector<CpuFreqResidency>>();
+  else
+    freqResidency->clear();
+  for(int32_t i = 0; i < arraySizeFreqResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      freqResidency->emplace_back();
+      int32_t dRst = freqResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeIdleResidency = 0;
+  int32_t rRstIdleResidency = caps->read(arraySizeIdleResidency);
+  if (rRstIdleResidency != CAPS_SUCCESS) return rRstIdleResidency;
+  if (!idleResidency)
+    idleResidency = std::make_shared<std::vector<CpuIdleResidency>>();
+  else
+    idleResidency->clear();
+  for(int32_t i = 0; i < arraySizeIdleResidency;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      idleResidency->emplace_back();
+      int32_t dRst = idleResidency->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,150 @@
+#ifndef _CPUFREQCORE_H
+#define _CPUFREQCORE_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "CpuFreqResidency.h"
+#include "CpuIdleResidency.h"
+namespace rokid {
+  /*
+   * frequency and idle residency of one cpu
+   */
+  class CpuFreqCore {
+  private:
+    int32_t cpu = 0;
+    int32_t cluster = 0;
+    int32_t capacity = 0;
+    int32_t curFreq = 0;
+    int32_t avgFreq = 0;
+    int32_t maxFreq = 0;
+    std::shared_ptr<std::vector<CpuFreqResidency>> freqResidency = nullptr;
+    std::shared_ptr<std::vector<CpuIdleResidency>> idleResidency = nullptr;
+  public:
+    inline static std::shared_ptr<CpuFreqCore> create() {
+      return std::make_shared<CpuFreqCore>();
+    }
+    /*
+    * getter cpu id
+    */
+    inline int32_t getCpu() const {
+      return cpu;
+    }
+    /*
+    * getter cluster id, -1 if unknown
+    */
+    inline int32_t getCluster() const {
+      return cluster;
+    }
+    /*
+    * getter cpu_capacity, 1024 is the biggest core at max frequency
+    */
+    inline int32_t getCapacity() const {
+      return capacity;
+    }
+    /*
+    * getter scaling_cur_freq in kHz
+    */
+    inline int32_t getCurFreq() const {
+      return curFreq;
+    }
+    /*
+    * getter average frequency in the interval in kHz
+    */
+    inline int32_t getAvgFreq() const {
+      return avgFreq;
+    }
+    /*
+    * getter cpuinfo_max_freq in kHz
+    */
+    inline int32_t getMaxFreq() const {
+      return maxFreq;
+    }
+    /*
+    * getter time_in_state deltas, frequencies not used are left out
+    */
+    inline const std::shared_ptr<std::vector<CpuFreqResidency>> getFreqResidency() const {
+      return freqResidency;
+    }
+    /*
+    * getter cpuidle state deltas
+    */
+    inline const std::shared_ptr<std::vector<CpuIdleResidency>> getIdleResidency() const {
+      return idleResidency;
+    }
+    /*
+    * setter cpu id
+    */
+    inline void setCpu(int32_t v) {
+      cpu = v;
+    }
+    /*
+    * setter cluster id, -1 if unknown
+    */
+    inline void setCluster(int32_t v) {
+      cluster = v;
+    }
+    /*
+    * setter cpu_capacity, 1024 is the biggest core at max frequency
+    */
+    inline void setCapacity(int32_t v) {
+      capacity = v;
+    }
+    /*
+    * setter scaling_cur_freq in kHz
+    */
+    inline void setCurFreq(int32_t v) {
+      curFreq = v;
+    }
+    /*
+    * setter average frequency in the interval in kHz
+    */
+    inline void setAvgFreq(int32_t v) {
+      avgFreq = v;
+    }
+    /*
+    * setter cpuinfo_max_freq in kHz
+    */
+    inline void setMaxFreq(int32_t v) {
+      maxFreq = v;
+    }
+    /*
+    * setter time_in_state deltas, frequencies not used are left out
+    */
+    inline void setFreqResidency(const std::shared_ptr<std::vector<CpuFreqResidency>> &v) {
+      this->freqResidency = v;
+    }
+    /*
+    * setter cpuidle state deltas
+    */
+    inline void setIdleResidency(const std::shared_ptr<std::vector<CpuIdleResidency>> &v) {
+      this->idleResidency = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CPUFREQCORE_H
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "CpuFreqInfos.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CpuFreqInfos::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQINFOS));
+  if (!cores)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cores->size());
+    for(auto &v : *cores) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!clusters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)clusters->size());
+    for(auto &v : *clusters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CpuFreqInfos::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQINFOS));
+  if (!cores)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cores->size());
+    for(auto &v : *cores) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!clusters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)clusters->size());
+    for(auto &v : *clusters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CpuFreqInfos::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeCores = 0;
+  int32_t rRstCores = caps->read(arraySizeCores);
+  if (rRstCores != CAPS_SUCCESS) return rRstCores;
+  if (!cores)
+    cores = std::make_shared<std::vector<CpuFreqCore>>();
+  else
+    cores->clear();
+  for(int32_t i = 0; i < arraySizeCores;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cores->emplace_back();
+      int32_t dRst = cores->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeClusters = 0;
+  int32_t rRstClusters = caps->read(arraySizeClusters);
+  if (rRstClusters != CAPS_SUCCESS) return rRstClusters;
+  if (!clusters)
+    clusters = std::make_shared<std::vector<CpuCluster>>();
+  else
+    clusters->clear();
+  for(int32_t i = 0; i < arraySizeClusters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      clusters->emplace_back();
+      int32_t dRst = clusters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CpuFreqInfos::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeCores = 0;
+  int32_t rRstCores = caps->read(arraySizeCores);
+  if (rRstCores != CAPS_SUCCESS) return rRstCores;
+  if (!cores)
+    cores = std::make_shared<std::vector<CpuFreqCore>>();
+  else
+    cores->clear();
+  for(int32_t i = 0; i < arraySizeCores;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cores->emplace_back();
+      int32_t dRst = cores->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeClusters = 0;
+  int32_t rRstClusters = caps->read(arraySizeClusters);
+  if (rRstClusters != CAPS_SUCCESS) return rRstClusters;
+  if (!clusters)
+    clusters = std::make_shared<std::vector<CpuCluster>>();
+  else
+    clusters->clear();
+  for(int32_t i = 0; i < arraySizeClusters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      clusters->emplace_back();
+      int32_t dRst = clusters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CpuFreqInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!cores)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cores->size());
+    for(auto &v : *cores) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!clusters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)clusters->size());
+    for(auto &v : *clusters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CpuFreqInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeCores = 0;
+  int32_t rRstCores = caps->read(arraySizeCores);
+  if (rRstCores != CAPS_SUCCESS) return rRstCores;
+  if (!cores)
+    cores = std::make_shared<std::vector<CpuFreqCore>>();
+  else
+    cores->clear();
+  for(int32_t i = 0; i < arraySizeCores;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cores->emplace_back();
+      int32_t dRst = cores->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeClusters = 0;
+  int32_t rRstClusters = caps->read(arraySizeClusters);
+  if (rRstClusters != CAPS_SUCCESS) return rRstClusters;
+  if (!clusters)
+    clusters = std::make_shared<std::vector<CpuCluster>>();
+  else
+    clusters->clear();
+  for(int32_t i = 0; i < arraySizeClusters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      clusters->emplace_back();
+      int32_t dRst = clusters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,85 @@
+#ifndef _CPUFREQINFOS_H
+#define _CPUFREQINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "CpuFreqCore.h"
+#include "CpuCluster.h"
+namespace rokid {
+  /*
+   * cpu frequency, idle residency and clusters
+   */
+  class CpuFreqInfos {
+  private:
+    std::shared_ptr<std::vector<CpuFreqCore>> cores = nullptr;
+    std::shared_ptr<std::vector<CpuCluster>> clusters = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<CpuFreqInfos> create() {
+      return std::make_shared<CpuFreqInfos>();
+    }
+    /*
+    * getter online cpus
+    */
+    inline const std::shared_ptr<std::vector<CpuFreqCore>> getCores() const {
+      return cores;
+    }
+    /*
+    * getter clusters
+    */
+    inline const std::shared_ptr<std::vector<CpuCluster>> getClusters() const {
+      return clusters;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter online cpus
+    */
+    inline void setCores(const std::shared_ptr<std::vector<CpuFreqCore>> &v) {
+      this->cores = v;
+    }
+    /*
+    * setter clusters
+    */
+    inline void setClusters(const std::shared_ptr<std::vector<CpuCluster>> &v) {
+      this->clusters = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CPUFREQINFOS_H
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "CpuFreqResidency.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CpuFreqResidency::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQRESIDENCY));
+  int32_t wRstFreq = caps->write((int32_t)freq);
+  if (wRstFreq != CAPS_SUCCESS) return wRstFreq;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CpuFreqResidency::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUFREQRESIDENCY));
+  int32_t wRstFreq = caps->write((int32_t)freq);
+  if (wRstFreq != CAPS_SUCCESS) return wRstFreq;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CpuFreqResidency::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstFreq = caps->read(freq);
+  if (rRstFreq != CAPS_SUCCESS) return rRstFreq;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CpuFreqResidency::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstFreq = caps->read(freq);
+  if (rRstFreq != CAPS_SUCCESS) return rRstFreq;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CpuFreqResidency::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstFreq = caps->write((int32_t)freq);
+  if (wRstFreq != CAPS_SUCCESS) return wRstFreq;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CpuFreqResidency::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstFreq = caps->read(freq);
+  if (rRstFreq != CAPS_SUCCESS) return rRstFreq;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,70 @@
+#ifndef _CPUFREQRESIDENCY_H
+#define _CPUFREQRESIDENCY_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * time spent at one frequency
+   */
+  class CpuFreqResidency {
+  private:
+    int32_t freq = 0;
+    float timeMs = 0;
+  public:
+    inline static std::shared_ptr<CpuFreqResidency> create() {
+      return std::make_shared<CpuFreqResidency>();
+    }
+    /*
+    * getter frequency in kHz
+    */
+    inline int32_t getFreq() const {
+      return freq;
+    }
+    /*
+    * getter milliseconds at freq in the interval
+    */
+    inline float getTimeMs() const {
+      return timeMs;
+    }
+    /*
+    * setter frequency in kHz
+    */
+    inline void setFreq(int32_t v) {
+      freq = v;
+    }
+    /*
+    * setter milliseconds at freq in the interval
+    */
+    inline void setTimeMs(float v) {
+      timeMs = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CPUFREQRESIDENCY_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "CpuIdleResidency.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t CpuIdleResidency::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUIDLERESIDENCY));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  int32_t wRstUsage = caps->write((int64_t)usage);
+  if (wRstUsage != CAPS_SUCCESS) return wRstUsage;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t CpuIdleResidency::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_CPUIDLERESIDENCY));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  int32_t wRstUsage = caps->write((int64_t)usage);
+  if (wRstUsage != CAPS_SUCCESS) return wRstUsage;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t CpuIdleResidency::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  int32_t rRstUsage = caps->read(usage);
+  if (rRstUsage != CAPS_SUCCESS) return rRstUsage;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t CpuIdleResidency::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  int32_t rRstUsage = caps->read(usage);
+  if (rRstUsage != CAPS_SUCCESS) return rRstUsage;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t CpuIdleResidency::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstTimeMs = caps->write((float)timeMs);
+  if (wRstTimeMs != CAPS_SUCCESS) return wRstTimeMs;
+  int32_t wRstUsage = caps->write((int64_t)usage);
+  if (wRstUsage != CAPS_SUCCESS) return wRstUsage;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t CpuIdleResidency::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstTimeMs = caps->read(timeMs);
+  if (rRstTimeMs != CAPS_SUCCESS) return rRstTimeMs;
+  int32_t rRstUsage = caps->read(usage);
+  if (rRstUsage != CAPS_SUCCESS) return rRstUsage;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,90 @@
+#ifndef _CPUIDLERESIDENCY_H
+#define _CPUIDLERESIDENCY_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * time spent in one cpuidle state
+   */
+  class CpuIdleResidency {
+  private:
+    std::shared_ptr<std::string> name = nullptr;
+    float timeMs = 0;
+    int64_t usage = 0;
+  public:
+    inline static std::shared_ptr<CpuIdleResidency> create() {
+      return std::make_shared<CpuIdleResidency>();
+    }
+    /*
+    * getter idle state name, e.g. WFI
+    */
+    inline const std::shared_ptr<std::string> getName() const {
+      return name;
+    }
+    /*
+    * getter milliseconds in the state in the interval
+    */
+    inline float getTimeMs() const {
+      return timeMs;
+    }
+    /*
+    * getter times entered in the interval
+    */
+    inline int64_t getUsage() const {
+      return usage;
+    }
+    /*
+    * setter idle state name, e.g. WFI
+    */
+    inline void setName(const std::shared_ptr<std::string> &v) {
+      name = v;
+    }
+    /*
+    * setter idle state name, e.g. WFI
+    */
+    inline void setName(const char* v) {
+      if (!name) name = std::make_shared<std::string>();
+      *name = v;
+    }
+    /*
+    * setter milliseconds in the state in the interval
+    */
+    inline void setTimeMs(float v) {
+      timeMs = v;
+    }
+    /*
+    * setter times entered in the interval
+    */
+    inline void setUsage(int64_t v) {
+      usage = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _CPUIDLERESIDENCY_H
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "DiskStat.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t DiskStat::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_DISKSTAT));
+  int32_t wRstDevice;
+  assert(device);
+  wRstDevice = caps->write(device->c_str());
+  if (wRstDevice != CAPS_SUCCESS) return wRstDevice;
+  int32_t wRstReadIops = caps->write((float)readIops);
+  if (wRstReadIops != CAPS_SUCCESS) return wRstReadIops;
+  int32_t wRstWriteIops = caps->write((float)writeIops);
+  if (wRstWriteIops != CAPS_SUCCESS) return wRstWriteIops;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstReadAwait = caps->write((float)readAwait);
+  if (wRstReadAwait != CAPS_SUCCESS) return wRstReadAwait;
+  int32_t wRstWriteAwait = caps->write((float)writeAwait);
+  if (wRstWriteAwait != CAPS_SUCCESS) return wRstWriteAwait;
+  int32_t wRstUtil = caps->write((float)util);
+  if (wRstUtil != CAPS_SUCCESS) return wRstUtil;
+  int32_t wRstQueueDepth = caps->write((float)queueDepth);
+  if (wRstQueueDepth != CAPS_SUCCESS) return wRstQueueDepth;
+  int32_t wRstInFlight = caps->write((uint32_t)inFlight);
+  if (wRstInFlight != CAPS_SUCCESS) return wRstInFlight;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t DiskStat::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_DISKSTAT));
+  int32_t wRstDevice;
+  assert(device);
+  wRstDevice = caps->write(device->c_str());
+  if (wRstDevice != CAPS_SUCCESS) return wRstDevice;
+  int32_t wRstReadIops = caps->write((float)readIops);
+  if (wRstReadIops != CAPS_SUCCESS) return wRstReadIops;
+  int32_t wRstWriteIops = caps->write((float)writeIops);
+  if (wRstWriteIops != CAPS_SUCCESS) return wRstWriteIops;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstReadAwait = caps->write((float)readAwait);
+  if (wRstReadAwait != CAPS_SUCCESS) return wRstReadAwait;
+  int32_t wRstWriteAwait = caps->write((float)writeAwait);
+  if (wRstWriteAwait != CAPS_SUCCESS) return wRstWriteAwait;
+  int32_t wRstUtil = caps->write((float)util);
+  if (wRstUtil != CAPS_SUCCESS) return wRstUtil;
+  int32_t wRstQueueDepth = caps->write((float)queueDepth);
+  if (wRstQueueDepth != CAPS_SUCCESS) return wRstQueueDepth;
+  int32_t wRstInFlight = caps->write((uint32_t)inFlight);
+  if (wRstInFlight != CAPS_SUCCESS) return wRstInFlight;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t DiskStat::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!device) device = std::make_shared<std::string>();
+  int32_t rRstDevice = caps->read_string(*device);
+  if (rRstDevice != CAPS_SUCCESS) return rRstDevice;
+  int32_t rRstReadIops = caps->read(readIops);
+  if (rRstReadIops != CAPS_SUCCESS) return rRstReadIops;
+  int32_t rRstWriteIops = caps->read(writeIops);
+  if (rRstWriteIops != CAPS_SUCCESS) return rRstWriteIops;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstReadAwait = caps->read(readAwait);
+  if (rRstReadAwait != CAPS_SUCCESS) return rRstReadAwait;
+  int32_t rRstWriteAwait = caps->read(writeAwait);
+  if (rRstWriteAwait != CAPS_SUCCESS) return rRstWriteAwait;
+  int32_t rRstUtil = caps->read(util);
+  if (rRstUtil != CAPS_SUCCESS) return rRstUtil;
+  int32_t rRstQueueDepth = caps->read(queueDepth);
+  if (rRstQueueDepth != CAPS_SUCCESS) return rRstQueueDepth;
+  int32_t rRstInFlight = caps->read(inFlight);
+  if (rRstInFlight != CAPS_SUCCESS) return rRstInFlight;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t DiskStat::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!device) device = std::make_shared<std::string>();
+  int32_t rRstDevice = caps->read_string(*device);
+  if (rRstDevice != CAPS_SUCCESS) return rRstDevice;
+  int32_t rRstReadIops = caps->read(readIops);
+  if (rRstReadIops != CAPS_SUCCESS) return rRstReadIops;
+  int32_t rRstWriteIops = caps->read(writeIops);
+  if (rRstWriteIops != CAPS_SUCCESS) return rRstWriteIops;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstReadAwait = caps->read(readAwait);
+  if (rRstReadAwait != CAPS_SUCCESS) return rRstReadAwait;
+  int32_t rRstWriteAwait = caps->read(writeAwait);
+  if (rRstWriteAwait != CAPS_SUCCESS) return rRstWriteAwait;
+  int32_t rRstUtil = caps->read(util);
+  if (rRstUtil != CAPS_SUCCESS) return rRstUtil;
+  int32_t rRstQueueDepth = caps->read(queueDepth);
+  if (rRstQueueDepth != CAPS_SUCCESS) return rRstQueueDepth;
+  int32_t rRstInFlight = caps->read(inFlight);
+  if (rRstInFlight != CAPS_SUCCESS) return rRstInFlight;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t DiskStat::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstDevice;
+  assert(device);
+  wRstDevice = caps->write(device->c_str());
+  if (wRstDevice != CAPS_SUCCESS) return wRstDevice;
+  int32_t wRstReadIops = caps->write((float)readIops);
+  if (wRstReadIops != CAPS_SUCCESS) return wRstReadIops;
+  int32_t wRstWriteIops = caps->write((float)writeIops);
+  if (wRstWriteIops != CAPS_SUCCESS) return wRstWriteIops;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstReadAwait = caps->write((float)readAwait);
+  if (wRstReadAwait != CAPS_SUCCESS) return wRstReadAwait;
+  int32_t wRstWriteAwait = caps->write((float)writeAwait);
+  if (wRstWriteAwait != CAPS_SUCCESS) return wRstWriteAwait;
+  int32_t wRstUtil = caps->write((float)util);
+  if (wRstUtil != CAPS_SUCCESS) return wRstUtil;
+  int32_t wRstQueueDepth = caps->write((float)queueDepth);
+  if (wRstQueueDepth != CAPS_SUCCESS) return wRstQueueDepth;
+  int32_t wRstInFlight = caps->write((uint32_t)inFlight);
+  if (wRstInFlight != CAPS_SUCCESS) return wRstInFlight;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t DiskStat::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!device) device = std::make_shared<std::string>();
+  int32_t rRstDevice = caps->read_string(*device);
+  if (rRstDevice != CAPS_SUCCESS) return rRstDevice;
+  int32_t rRstReadIops = caps->read(readIops);
+  if (rRstReadIops != CAPS_SUCCESS) return rRstReadIops;
+  int32_t rRstWriteIops = caps->read(writeIops);
+  if (rRstWriteIops != CAPS_SUCCESS) return rRstWriteIops;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstReadAwait = caps->read(readAwait);
+  if (rRstReadAwait != CAPS_SUCCESS) return rRstReadAwait;
+  int32_t rRstWriteAwait = caps->read(writeAwait);
+  if (rRstWriteAwait != CAPS_SUCCESS) return rRstWriteAwait;
+  int32_t rRstUtil = caps->read(util);
+  if (rRstUtil != CAPS_SUCCESS) return rRstUtil;
+  int32_t rRstQueueDepth = caps->read(queueDepth);
+  if (rRstQueueDepth != CAPS_SUCCESS) return rRstQueueDepth;
+  int32_t rRstInFlight = caps->read(inFlight);
+  if (rRstInFlight != CAPS_SUCCESS) return rRstInFlight;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,181 @@
+#ifndef _DISKSTAT_H
+#define _DISKSTAT_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * io statistics of one block device
+   */
+  class DiskStat {
+  private:
+    std::shared_ptr<std::string> device = nullptr;
+    float readIops = 0;
+    float writeIops = 0;
+    float readBytes = 0;
+    float writeBytes = 0;
+    float readAwait = 0;
+    float writeAwait = 0;
+    float util = 0;
+    float queueDepth = 0;
+    uint32_t inFlight = 0;
+  public:
+    inline static std::shared_ptr<DiskStat> create() {
+      return std::make_shared<DiskStat>();
+    }
+    /*
+    * getter device name
+    */
+    inline const std::shared_ptr<std::string> getDevice() const {
+      return device;
+    }
+    /*
+    * getter reads completed per second
+    */
+    inline float getReadIops() const {
+      return readIops;
+    }
+    /*
+    * getter writes completed per second
+    */
+    inline float getWriteIops() const {
+      return writeIops;
+    }
+    /*
+    * getter bytes read per second
+    */
+    inline float getReadBytes() const {
+      return readBytes;
+    }
+    /*
+    * getter bytes written per second
+    */
+    inline float getWriteBytes() const {
+      return writeBytes;
+    }
+    /*
+    * getter average milliseconds of a read
+    */
+    inline float getReadAwait() const {
+      return readAwait;
+    }
+    /*
+    * getter average milliseconds of a write
+    */
+    inline float getWriteAwait() const {
+      return writeAwait;
+    }
+    /*
+    * getter percent of time the device was busy
+    */
+    inline float getUtil() const {
+      return util;
+    }
+    /*
+    * getter average requests queued or in service
+    */
+    inline float getQueueDepth() const {
+      return queueDepth;
+    }
+    /*
+    * getter requests in service when sampled
+    */
+    inline uint32_t getInFlight() const {
+      return inFlight;
+    }
+    /*
+    * setter device name
+    */
+    inline void setDevice(const std::shared_ptr<std::string> &v) {
+      device = v;
+    }
+    /*
+    * setter device name
+    */
+    inline void setDevice(const char* v) {
+      if (!device) device = std::make_shared<std::string>();
+      *device = v;
+    }
+    /*
+    * setter reads completed per second
+    */
+    inline void setReadIops(float v) {
+      readIops = v;
+    }
+    /*
+    * setter writes completed per second
+    */
+    inline void setWriteIops(float v) {
+      writeIops = v;
+    }
+    /*
+    * setter bytes read per second
+    */
+    inline void setReadBytes(float v) {
+      readBytes = v;
+    }
+    /*
+    * setter bytes written per second
+    */
+    inline void setWriteBytes(float v) {
+      writeBytes = v;
+    }
+    /*
+    * setter average milliseconds of a read
+    */
+    inline void setReadAwait(float v) {
+      readAwait = v;
+    }
+    /*
+    * setter average milliseconds of a write
+    */
+    inline void setWriteAwait(float v) {
+      writeAwait = v;
+    }
+    /*
+    * setter percent of time the device was busy
+    */
+    inline void setUtil(float v) {
+      util = v;
+    }
+    /*
+    * setter average requests queued or in service
+    */
+    inline void setQueueDepth(float v) {
+      queueDepth = v;
+    }
+    /*
+    * setter requests in service when sampled
+    */
+    inline void setInFlight(uint32_t v) {
+      inFlight = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _DISKSTAT_H
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef _DISKSTATS_H
+#define _DISKSTATS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "DiskStat.h"
+namespace rokid {
+  /*
+   * block device io from /proc/diskstats
+   */
+  class DiskStats {
+  private:
+    std::shared_ptr<std::vector<DiskStat>> disks = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<DiskStats> create() {
+      return std::make_shared<DiskStats>();
+    }
+    /*
+    * getter block devices
+    */
+    inline const std::shared_ptr<std::vector<DiskStat>> getDisks() const {
+      return disks;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter block devices
+    */
+    inline void setDisks(const std::shared_ptr<std::vector<DiskStat>> &v) {
+      this->disks = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _DISKSTATS_H
\ No newline at end of file
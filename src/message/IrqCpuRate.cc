@@ -0,0 +1,73 @@
+#include "IrqCpuRate.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t IrqCpuRate::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQCPURATE));
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t IrqCpuRate::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQCPURATE));
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t IrqCpuRate::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t IrqCpuRate::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t IrqCpuRate::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t IrqCpuRate::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+
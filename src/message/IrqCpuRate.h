@@ -0,0 +1,70 @@
+#ifndef _IRQCPURATE_H
+#define _IRQCPURATE_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * rate of one irq on one cpu
+   */
+  class IrqCpuRate {
+  private:
+    int32_t cpu = 0;
+    float rate = 0;
+  public:
+    inline static std::shared_ptr<IrqCpuRate> create() {
+      return std::make_shared<IrqCpuRate>();
+    }
+    /*
+    * getter cpu id
+    */
+    inline int32_t getCpu() const {
+      return cpu;
+    }
+    /*
+    * getter per second
+    */
+    inline float getRate() const {
+      return rate;
+    }
+    /*
+    * setter cpu id
+    */
+    inline void setCpu(int32_t v) {
+      cpu = v;
+    }
+    /*
+    * setter per second
+    */
+    inline void setRate(float v) {
+      rate = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _IRQCPURATE_H
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "IrqInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t IrqInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQINFO));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstDesc;
+  assert(desc);
+  wRstDesc = caps->write(desc->c_str());
+  if (wRstDesc != CAPS_SUCCESS) return wRstDesc;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  if (!cpus)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cpus->size());
+    for(auto &v : *cpus) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t IrqInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQINFO));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstDesc;
+  assert(desc);
+  wRstDesc = caps->write(desc->c_str());
+  if (wRstDesc != CAPS_SUCCESS) return wRstDesc;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  if (!cpus)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cpus->size());
+    for(auto &v : *cpus) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t IrqInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!desc) desc = std::make_shared<std::string>();
+  int32_t rRstDesc = caps->read_string(*desc);
+  if (rRstDesc != CAPS_SUCCESS) return rRstDesc;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  int32_t arraySizeCpus = 0;
+  int32_t rRstCpus = caps->read(arraySizeCpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  if (!cpus)
+    cpus = std::make_shared<std::vector<IrqCpuRate>>();
+  else
+    cpus->clear();
+  for(int32_t i = 0; i < arraySizeCpus;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cpus->emplace_back();
+      int32_t dRst = cpus->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t IrqInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!desc) desc = std::make_shared<std::string>();
+  int32_t rRstDesc = caps->read_string(*desc);
+  if (rRstDesc != CAPS_SUCCESS) return rRstDesc;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  int32_t arraySizeCpus = 0;
+  int32_t rRstCpus = caps->read(arraySizeCpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  if (!cpus)
+    cpus = std::make_shared<std::vector<IrqCpuRate>>();
+  else
+    cpus->clear();
+  for(int32_t i = 0; i < arraySizeCpus;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cpus->emplace_back();
+      int32_t dRst = cpus->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t IrqInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstDesc;
+  assert(desc);
+  wRstDesc = caps->write(desc->c_str());
+  if (wRstDesc != CAPS_SUCCESS) return wRstDesc;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  if (!cpus)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)cpus->size());
+    for(auto &v : *cpus) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t IrqInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!desc) desc = std::make_shared<std::string>();
+  int32_t rRstDesc = caps->read_string(*desc);
+  if (rRstDesc != CAPS_SUCCESS) return rRstDesc;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  int32_t arraySizeCpus = 0;
+  int32_t rRstCpus = caps->read(arraySizeCpus);
+  if (rRstCpus != CAPS_SUCCESS) return rRstCpus;
+  if (!cpus)
+    cpus = std::make_shared<std::vector<IrqCpuRate>>();
+  else
+    cpus->clear();
+  for(int32_t i = 0; i < arraySizeCpus;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      cpus->emplace_back();
+      int32_t dRst = cpus->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,111 @@
+#ifndef _IRQINFO_H
+#define _IRQINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "IrqCpuRate.h"
+namespace rokid {
+  /*
+   * rate of one interrupt or softirq
+   */
+  class IrqInfo {
+  private:
+    std::shared_ptr<std::string> name = nullptr;
+    std::shared_ptr<std::string> desc = nullptr;
+    float rate = 0;
+    std::shared_ptr<std::vector<IrqCpuRate>> cpus = nullptr;
+  public:
+    inline static std::shared_ptr<IrqInfo> create() {
+      return std::make_shared<IrqInfo>();
+    }
+    /*
+    * getter irq number or name, e.g. 24, LOC, NET_RX
+    */
+    inline const std::shared_ptr<std::string> getName() const {
+      return name;
+    }
+    /*
+    * getter controller, trigger and device of the irq, empty for softirqs
+    */
+    inline const std::shared_ptr<std::string> getDesc() const {
+      return desc;
+    }
+    /*
+    * getter per second on all cpus
+    */
+    inline float getRate() const {
+      return rate;
+    }
+    /*
+    * getter per cpu, cpus without any are left out
+    */
+    inline const std::shared_ptr<std::vector<IrqCpuRate>> getCpus() const {
+      return cpus;
+    }
+    /*
+    * setter irq number or name, e.g. 24, LOC, NET_RX
+    */
+    inline void setName(const std::shared_ptr<std::string> &v) {
+      name = v;
+    }
+    /*
+    * setter irq number or name, e.g. 24, LOC, NET_RX
+    */
+    inline void setName(const char* v) {
+      if (!name) name = std::make_shared<std::string>();
+      *name = v;
+    }
+    /*
+    * setter controller, trigger and device of the irq, empty for softirqs
+    */
+    inline void setDesc(const std::shared_ptr<std::string> &v) {
+      desc = v;
+    }
+    /*
+    * setter controller, trigger and device of the irq, empty for softirqs
+    */
+    inline void setDesc(const char* v) {
+      if (!desc) desc = std::make_shared<std::string>();
+      *desc = v;
+    }
+    /*
+    * setter per second on all cpus
+    */
+    inline void setRate(float v) {
+      rate = v;
+    }
+    /*
+    * setter per cpu, cpus without any are left out
+    */
+    inline void setCpus(const std::shared_ptr<std::vector<IrqCpuRate>> &v) {
+      this->cpus = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _IRQINFO_H
\ No newline at end of file
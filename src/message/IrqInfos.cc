@@ -0,0 +1,253 @@
+#include "IrqInfos.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t IrqInfos::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQINFOS));
+  if (!irqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)irqs->size());
+    for(auto &v : *irqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!softirqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)softirqs->size());
+    for(auto &v : *softirqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstIrqRate = caps->write((float)irqRate);
+  if (wRstIrqRate != CAPS_SUCCESS) return wRstIrqRate;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t IrqInfos::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_IRQINFOS));
+  if (!irqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)irqs->size());
+    for(auto &v : *irqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!softirqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)softirqs->size());
+    for(auto &v : *softirqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstIrqRate = caps->write((float)irqRate);
+  if (wRstIrqRate != CAPS_SUCCESS) return wRstIrqRate;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t IrqInfos::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeIrqs = 0;
+  int32_t rRstIrqs = caps->read(arraySizeIrqs);
+  if (rRstIrqs != CAPS_SUCCESS) return rRstIrqs;
+  if (!irqs)
+    irqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    irqs->clear();
+  for(int32_t i = 0; i < arraySizeIrqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      irqs->emplace_back();
+      int32_t dRst = irqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeSoftirqs = 0;
+  int32_t rRstSoftirqs = caps->read(arraySizeSoftirqs);
+  if (rRstSoftirqs != CAPS_SUCCESS) return rRstSoftirqs;
+  if (!softirqs)
+    softirqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    softirqs->clear();
+  for(int32_t i = 0; i < arraySizeSoftirqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      softirqs->emplace_back();
+      int32_t dRst = softirqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstIrqRate = caps->read(irqRate);
+  if (rRstIrqRate != CAPS_SUCCESS) return rRstIrqRate;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t IrqInfos::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeIrqs = 0;
+  int32_t rRstIrqs = caps->read(arraySizeIrqs);
+  if (rRstIrqs != CAPS_SUCCESS) return rRstIrqs;
+  if (!irqs)
+    irqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    irqs->clear();
+  for(int32_t i = 0; i < arraySizeIrqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      irqs->emplace_back();
+      int32_t dRst = irqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeSoftirqs = 0;
+  int32_t rRstSoftirqs = caps->read(arraySizeSoftirqs);
+  if (rRstSoftirqs != CAPS_SUCCESS) return rRstSoftirqs;
+  if (!softirqs)
+    softirqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    softirqs->clear();
+  for(int32_t i = 0; i < arraySizeSoftirqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      softirqs->emplace_back();
+      int32_t dRst = softirqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstIrqRate = caps->read(irqRate);
+  if (rRstIrqRate != CAPS_SUCCESS) return rRstIrqRate;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t IrqInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!irqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)irqs->size());
+    for(auto &v : *irqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!softirqs)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)softirqs->size());
+    for(auto &v : *softirqs) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstIrqRate = caps->write((float)irqRate);
+  if (wRstIrqRate != CAPS_SUCCESS) return wRstIrqRate;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t IrqInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeIrqs = 0;
+  int32_t rRstIrqs = caps->read(arraySizeIrqs);
+  if (rRstIrqs != CAPS_SUCCESS) return rRstIrqs;
+  if (!irqs)
+    irqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    irqs->clear();
+  for(int32_t i = 0; i < arraySizeIrqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      irqs->emplace_back();
+      int32_t dRst = irqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeSoftirqs = 0;
+  int32_t rRstSoftirqs = caps->read(arraySizeSoftirqs);
+  if (rRstSoftirqs != CAPS_SUCCESS) return rRstSoftirqs;
+  if (!softirqs)
+    softirqs = std::make_shared<std::vector<IrqInfo>>();
+  else
+    softirqs->clear();
+  for(int32_t i = 0; i < arraySizeSoftirqs;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      softirqs->emplace_back();
+      int32_t dRst = softirqs->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstIrqRate = caps->read(irqRate);
+  if (rRstIrqRate != CAPS_SUCCESS) return rRstIrqRate;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,98 @@
+#ifndef _IRQINFOS_H
+#define _IRQINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "IrqInfo.h"
+#include "IrqInfo.h"
+namespace rokid {
+  /*
+   * interrupt and softirq rates
+   */
+  class IrqInfos {
+  private:
+    std::shared_ptr<std::vector<IrqInfo>> irqs = nullptr;
+    std::shared_ptr<std::vector<IrqInfo>> softirqs = nullptr;
+    float irqRate = 0;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<IrqInfos> create() {
+      return std::make_shared<IrqInfos>();
+    }
+    /*
+    * getter busiest interrupts of /proc/interrupts
+    */
+    inline const std::shared_ptr<std::vector<IrqInfo>> getIrqs() const {
+      return irqs;
+    }
+    /*
+    * getter softirqs with any count
+    */
+    inline const std::shared_ptr<std::vector<IrqInfo>> getSoftirqs() const {
+      return softirqs;
+    }
+    /*
+    * getter per second of all interrupts
+    */
+    inline float getIrqRate() const {
+      return irqRate;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter busiest interrupts of /proc/interrupts
+    */
+    inline void setIrqs(const std::shared_ptr<std::vector<IrqInfo>> &v) {
+      this->irqs = v;
+    }
+    /*
+    * setter softirqs with any count
+    */
+    inline void setSoftirqs(const std::shared_ptr<std::vector<IrqInfo>> &v) {
+      this->softirqs = v;
+    }
+    /*
+    * setter per second of all interrupts
+    */
+    inline void setIrqRate(float v) {
+      irqRate = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _IRQINFOS_H
\ No newline at end of file
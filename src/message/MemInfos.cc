@@ -33,6 +33,12 @@ int32_t MemInfos::serialize(void* buf, uint32_t bufsize) const {
   }
   int32_t wRstTimestamp = caps->write((int64_t)timestamp);
   if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  int32_t wRstScanDuration = caps->write((int64_t)scanDuration);
+  if (wRstScanDuration != CAPS_SUCCESS) return wRstScanDuration;
+  int32_t wRstScanCpuTime = caps->write((int64_t)scanCpuTime);
+  if (wRstScanCpuTime != CAPS_SUCCESS) return wRstScanCpuTime;
+  int32_t wRstScanYields = caps->write((int32_t)scanYields);
+  if (wRstScanYields != CAPS_SUCCESS) return wRstScanYields;
   return caps->serialize(buf, bufsize);
 }
 /*
@@ -68,6 +74,12 @@ int32_t MemInfos::serialize(std::shared_ptr<Caps> &caps) const {
   }
   int32_t wRstTimestamp = caps->write((int64_t)timestamp);
   if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  int32_t wRstScanDuration = caps->write((int64_t)scanDuration);
+  if (wRstScanDuration != CAPS_SUCCESS) return wRstScanDuration;
+  int32_t wRstScanCpuTime = caps->write((int64_t)scanCpuTime);
+  if (wRstScanCpuTime != CAPS_SUCCESS) return wRstScanCpuTime;
+  int32_t wRstScanYields = caps->write((int32_t)scanYields);
+  if (wRstScanYields != CAPS_SUCCESS) return wRstScanYields;
   return CAPS_SUCCESS;
 }
 /*
@@ -100,6 +112,12 @@ int32_t MemInfos::deserialize(void* buf, uint32_t bufSize) {
   if (rRstSysMem != CAPS_SUCCESS) return rRstSysMem;
   int32_t rRstTimestamp = caps->read(timestamp);
   if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  int32_t rRstScanDuration = caps->read(scanDuration);
+  if (rRstScanDuration != CAPS_SUCCESS) return rRstScanDuration;
+  int32_t rRstScanCpuTime = caps->read(scanCpuTime);
+  if (rRstScanCpuTime != CAPS_SUCCESS) return rRstScanCpuTime;
+  int32_t rRstScanYields = caps->read(scanYields);
+  if (rRstScanYields != CAPS_SUCCESS) return rRstScanYields;
   return CAPS_SUCCESS;
 }
 /*
@@ -129,6 +147,12 @@ int32_t MemInfos::deserialize(std::shared_ptr<Caps> &caps) {
   if (rRstSysMem != CAPS_SUCCESS) return rRstSysMem;
   int32_t rRstTimestamp = caps->read(timestamp);
   if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  int32_t rRstScanDuration = caps->read(scanDuration);
+  if (rRstScanDuration != CAPS_SUCCESS) return rRstScanDuration;
+  int32_t rRstScanCpuTime = caps->read(scanCpuTime);
+  if (rRstScanCpuTime != CAPS_SUCCESS) return rRstScanCpuTime;
+  int32_t rRstScanYields = caps->read(scanYields);
+  if (rRstScanYields != CAPS_SUCCESS) return rRstScanYields;
   return CAPS_SUCCESS;
 }
 /*
@@ -162,6 +186,12 @@ int32_t MemInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
   }
   int32_t wRstTimestamp = caps->write((int64_t)timestamp);
   if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  int32_t wRstScanDuration = caps->write((int64_t)scanDuration);
+  if (wRstScanDuration != CAPS_SUCCESS) return wRstScanDuration;
+  int32_t wRstScanCpuTime = caps->write((int64_t)scanCpuTime);
+  if (wRstScanCpuTime != CAPS_SUCCESS) return wRstScanCpuTime;
+  int32_t wRstScanYields = caps->write((int32_t)scanYields);
+  if (wRstScanYields != CAPS_SUCCESS) return wRstScanYields;
   return CAPS_SUCCESS;
 }
 /*
@@ -191,6 +221,12 @@ int32_t MemInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
   if (rRstSysMem != CAPS_SUCCESS) return rRstSysMem;
   int32_t rRstTimestamp = caps->read(timestamp);
   if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  int32_t rRstScanDuration = caps->read(scanDuration);
+  if (rRstScanDuration != CAPS_SUCCESS) return rRstScanDuration;
+  int32_t rRstScanCpuTime = caps->read(scanCpuTime);
+  if (rRstScanCpuTime != CAPS_SUCCESS) return rRstScanCpuTime;
+  int32_t rRstScanYields = caps->read(scanYields);
+  if (rRstScanYields != CAPS_SUCCESS) return rRstScanYields;
   return CAPS_SUCCESS;
 }
 
@@ -15,6 +15,9 @@ namespace rokid {
     std::shared_ptr<std::vector<ProcMemInfo>> procMemInfo = nullptr;
     std::shared_ptr<SysMemInfo> sysMem = nullptr;
     int64_t timestamp = 0;
+    int64_t scanDuration = 0;
+    int64_t scanCpuTime = 0;
+    int32_t scanYields = 0;
   public:
     inline static std::shared_ptr<MemInfos> create() {
       return std::make_shared<MemInfos>();
@@ -38,6 +41,24 @@ namespace rokid {
       return timestamp;
     }
     /*
+    * getter wall time of the smaps walk in ms
+    */
+    inline int64_t getScanDuration() const {
+      return scanDuration;
+    }
+    /*
+    * getter cpu time of the smaps walk in us
+    */
+    inline int64_t getScanCpuTime() const {
+      return scanCpuTime;
+    }
+    /*
+    * getter times the walk gave up its thread for the cpu budget
+    */
+    inline int32_t getScanYields() const {
+      return scanYields;
+    }
+    /*
     * setter processes memory info
     */
     inline void setProcMemInfo(const std::shared_ptr<std::vector<ProcMemInfo>> &v) {
@@ -55,6 +76,24 @@ namespace rokid {
     inline void setTimestamp(int64_t v) {
       timestamp = v;
     }
+    /*
+    * setter wall time of the smaps walk in ms
+    */
+    inline void setScanDuration(int64_t v) {
+      scanDuration = v;
+    }
+    /*
+    * setter cpu time of the smaps walk in us
+    */
+    inline void setScanCpuTime(int64_t v) {
+      scanCpuTime = v;
+    }
+    /*
+    * setter times the walk gave up its thread for the cpu budget
+    */
+    inline void setScanYields(int32_t v) {
+      scanYields = v;
+    }
     /*
      * serialize this object as buffer
     */
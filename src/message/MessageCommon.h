@@ -16,6 +16,35 @@
 #include "TaskStatus.h"
 #include "DeviceStatus.h"
 #include "BatteryInfos.h"
+#include "SysCounters.h"
+#include "PressureInfo.h"
+#include "PressureInfos.h"
+#include "PressureEvent.h"
+#include "VmstatInfo.h"
+#include "VmstatInfos.h"
+#include "DiskStat.h"
+#include "DiskStats.h"
+#include "NetDevStat.h"
+#include "NetDevStats.h"
+#include "ProcIOInfo.h"
+#include "ProcIOInfos.h"
+#include "SchedWaitInfo.h"
+#include "SchedWaitInfos.h"
+#include "CgroupInfo.h"
+#include "CgroupInfos.h"
+#include "ThermalZone.h"
+#include "CoolingDevice.h"
+#include "ThermalInfos.h"
+#include "CpuFreqResidency.h"
+#include "CpuIdleResidency.h"
+#include "CpuFreqCore.h"
+#include "CpuCluster.h"
+#include "CpuFreqInfos.h"
+#include "IrqCpuRate.h"
+#include "IrqInfo.h"
+#include "IrqInfos.h"
+#include "SmapFileInfo.h"
+#include "SmapFileInfos.h"
 #include <vector>
 #include <string>
 
@@ -40,6 +69,35 @@ namespace rokid{
   typedef std::shared_ptr<TaskStatus> TaskStatusPtr;
   typedef std::shared_ptr<DeviceStatus> DeviceStatusPtr;
   typedef std::shared_ptr<BatteryInfos> BatteryInfosPtr;
+  typedef std::shared_ptr<SysCounters> SysCountersPtr;
+  typedef std::shared_ptr<PressureInfo> PressureInfoPtr;
+  typedef std::shared_ptr<PressureInfos> PressureInfosPtr;
+  typedef std::shared_ptr<PressureEvent> PressureEventPtr;
+  typedef std::shared_ptr<VmstatInfo> VmstatInfoPtr;
+  typedef std::shared_ptr<VmstatInfos> VmstatInfosPtr;
+  typedef std::shared_ptr<DiskStat> DiskStatPtr;
+  typedef std::shared_ptr<DiskStats> DiskStatsPtr;
+  typedef std::shared_ptr<NetDevStat> NetDevStatPtr;
+  typedef std::shared_ptr<NetDevStats> NetDevStatsPtr;
+  typedef std::shared_ptr<ProcIOInfo> ProcIOInfoPtr;
+  typedef std::shared_ptr<ProcIOInfos> ProcIOInfosPtr;
+  typedef std::shared_ptr<SchedWaitInfo> SchedWaitInfoPtr;
+  typedef std::shared_ptr<SchedWaitInfos> SchedWaitInfosPtr;
+  typedef std::shared_ptr<CgroupInfo> CgroupInfoPtr;
+  typedef std::shared_ptr<CgroupInfos> CgroupInfosPtr;
+  typedef std::shared_ptr<ThermalZone> ThermalZonePtr;
+  typedef std::shared_ptr<CoolingDevice> CoolingDevicePtr;
+  typedef std::shared_ptr<ThermalInfos> ThermalInfosPtr;
+  typedef std::shared_ptr<CpuFreqResidency> CpuFreqResidencyPtr;
+  typedef std::shared_ptr<CpuIdleResidency> CpuIdleResidencyPtr;
+  typedef std::shared_ptr<CpuFreqCore> CpuFreqCorePtr;
+  typedef std::shared_ptr<CpuCluster> CpuClusterPtr;
+  typedef std::shared_ptr<CpuFreqInfos> CpuFreqInfosPtr;
+  typedef std::shared_ptr<IrqCpuRate> IrqCpuRatePtr;
+  typedef std::shared_ptr<IrqInfo> IrqInfoPtr;
+  typedef std::shared_ptr<IrqInfos> IrqInfosPtr;
+  typedef std::shared_ptr<SmapFileInfo> SmapFileInfoPtr;
+  typedef std::shared_ptr<SmapFileInfos> SmapFileInfosPtr;
   /*
    * you should call this function when you got message package,
    * [in] buff: the packgae buffer
@@ -24,6 +24,35 @@ namespace rokid{
     TYPE_TASKSTATUS,
     TYPE_DEVICESTATUS,
     TYPE_BATTERYINFOS,
+    TYPE_SYSCOUNTERS,
+    TYPE_PRESSUREINFO,
+    TYPE_PRESSUREINFOS,
+    TYPE_PRESSUREEVENT,
+    TYPE_VMSTATINFO,
+    TYPE_VMSTATINFOS,
+    TYPE_DISKSTAT,
+    TYPE_DISKSTATS,
+    TYPE_NETDEVSTAT,
+    TYPE_NETDEVSTATS,
+    TYPE_PROCIOINFO,
+    TYPE_PROCIOINFOS,
+    TYPE_SCHEDWAITINFO,
+    TYPE_SCHEDWAITINFOS,
+    TYPE_CGROUPINFO,
+    TYPE_CGROUPINFOS,
+    TYPE_THERMALZONE,
+    TYPE_COOLINGDEVICE,
+    TYPE_THERMALINFOS,
+    TYPE_CPUFREQRESIDENCY,
+    TYPE_CPUIDLERESIDENCY,
+    TYPE_CPUFREQCORE,
+    TYPE_CPUCLUSTER,
+    TYPE_CPUFREQINFOS,
+    TYPE_IRQCPURATE,
+    TYPE_IRQINFO,
+    TYPE_IRQINFOS,
+    TYPE_SMAPFILEINFO,
+    TYPE_SMAPFILEINFOS,
     TYPE_UNKNOWN
   };
 }
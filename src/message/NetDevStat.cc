@@ -0,0 +1,166 @@
+#include "NetDevStat.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t NetDevStat::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_NETDEVSTAT));
+  int32_t wRstInterface;
+  assert(interface);
+  wRstInterface = caps->write(interface->c_str());
+  if (wRstInterface != CAPS_SUCCESS) return wRstInterface;
+  int32_t wRstRxBytes = caps->write((float)rxBytes);
+  if (wRstRxBytes != CAPS_SUCCESS) return wRstRxBytes;
+  int32_t wRstRxPackets = caps->write((float)rxPackets);
+  if (wRstRxPackets != CAPS_SUCCESS) return wRstRxPackets;
+  int32_t wRstRxErrors = caps->write((float)rxErrors);
+  if (wRstRxErrors != CAPS_SUCCESS) return wRstRxErrors;
+  int32_t wRstRxDrops = caps->write((float)rxDrops);
+  if (wRstRxDrops != CAPS_SUCCESS) return wRstRxDrops;
+  int32_t wRstTxBytes = caps->write((float)txBytes);
+  if (wRstTxBytes != CAPS_SUCCESS) return wRstTxBytes;
+  int32_t wRstTxPackets = caps->write((float)txPackets);
+  if (wRstTxPackets != CAPS_SUCCESS) return wRstTxPackets;
+  int32_t wRstTxErrors = caps->write((float)txErrors);
+  if (wRstTxErrors != CAPS_SUCCESS) return wRstTxErrors;
+  int32_t wRstTxDrops = caps->write((float)txDrops);
+  if (wRstTxDrops != CAPS_SUCCESS) return wRstTxDrops;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t NetDevStat::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_NETDEVSTAT));
+  int32_t wRstInterface;
+  assert(interface);
+  wRstInterface = caps->write(interface->c_str());
+  if (wRstInterface != CAPS_SUCCESS) return wRstInterface;
+  int32_t wRstRxBytes = caps->write((float)rxBytes);
+  if (wRstRxBytes != CAPS_SUCCESS) return wRstRxBytes;
+  int32_t wRstRxPackets = caps->write((float)rxPackets);
+  if (wRstRxPackets != CAPS_SUCCESS) return wRstRxPackets;
+  int32_t wRstRxErrors = caps->write((float)rxErrors);
+  if (wRstRxErrors != CAPS_SUCCESS) return wRstRxErrors;
+  int32_t wRstRxDrops = caps->write((float)rxDrops);
+  if (wRstRxDrops != CAPS_SUCCESS) return wRstRxDrops;
+  int32_t wRstTxBytes = caps->write((float)txBytes);
+  if (wRstTxBytes != CAPS_SUCCESS) return wRstTxBytes;
+  int32_t wRstTxPackets = caps->write((float)txPackets);
+  if (wRstTxPackets != CAPS_SUCCESS) return wRstTxPackets;
+  int32_t wRstTxErrors = caps->write((float)txErrors);
+  if (wRstTxErrors != CAPS_SUCCESS) return wRstTxErrors;
+  int32_t wRstTxDrops = caps->write((float)txDrops);
+  if (wRstTxDrops != CAPS_SUCCESS) return wRstTxDrops;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t NetDevStat::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!interface) interface = std::make_shared<std::string>();
+  int32_t rRstInterface = caps->read_string(*interface);
+  if (rRstInterface != CAPS_SUCCESS) return rRstInterface;
+  int32_t rRstRxBytes = caps->read(rxBytes);
+  if (rRstRxBytes != CAPS_SUCCESS) return rRstRxBytes;
+  int32_t rRstRxPackets = caps->read(rxPackets);
+  if (rRstRxPackets != CAPS_SUCCESS) return rRstRxPackets;
+  int32_t rRstRxErrors = caps->read(rxErrors);
+  if (rRstRxErrors != CAPS_SUCCESS) return rRstRxErrors;
+  int32_t rRstRxDrops = caps->read(rxDrops);
+  if (rRstRxDrops != CAPS_SUCCESS) return rRstRxDrops;
+  int32_t rRstTxBytes = caps->read(txBytes);
+  if (rRstTxBytes != CAPS_SUCCESS) return rRstTxBytes;
+  int32_t rRstTxPackets = caps->read(txPackets);
+  if (rRstTxPackets != CAPS_SUCCESS) return rRstTxPackets;
+  int32_t rRstTxErrors = caps->read(txErrors);
+  if (rRstTxErrors != CAPS_SUCCESS) return rRstTxErrors;
+  int32_t rRstTxDrops = caps->read(txDrops);
+  if (rRstTxDrops != CAPS_SUCCESS) return rRstTxDrops;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t NetDevStat::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!interface) interface = std::make_shared<std::string>();
+  int32_t rRstInterface = caps->read_string(*interface);
+  if (rRstInterface != CAPS_SUCCESS) return rRstInterface;
+  int32_t rRstRxBytes = caps->read(rxBytes);
+  if (rRstRxBytes != CAPS_SUCCESS) return rRstRxBytes;
+  int32_t rRstRxPackets = caps->read(rxPackets);
+  if (rRstRxPackets != CAPS_SUCCESS) return rRstRxPackets;
+  int32_t rRstRxErrors = caps->read(rxErrors);
+  if (rRstRxErrors != CAPS_SUCCESS) return rRstRxErrors;
+  int32_t rRstRxDrops = caps->read(rxDrops);
+  if (rRstRxDrops != CAPS_SUCCESS) return rRstRxDrops;
+  int32_t rRstTxBytes = caps->read(txBytes);
+  if (rRstTxBytes != CAPS_SUCCESS) return rRstTxBytes;
+  int32_t rRstTxPackets = caps->read(txPackets);
+  if (rRstTxPackets != CAPS_SUCCESS) return rRstTxPackets;
+  int32_t rRstTxErrors = caps->read(txErrors);
+  if (rRstTxErrors != CAPS_SUCCESS) return rRstTxErrors;
+  int32_t rRstTxDrops = caps->read(txDrops);
+  if (rRstTxDrops != CAPS_SUCCESS) return rRstTxDrops;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t NetDevStat::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstInterface;
+  assert(interface);
+  wRstInterface = caps->write(interface->c_str());
+  if (wRstInterface != CAPS_SUCCESS) return wRstInterface;
+  int32_t wRstRxBytes = caps->write((float)rxBytes);
+  if (wRstRxBytes != CAPS_SUCCESS) return wRstRxBytes;
+  int32_t wRstRxPackets = caps->write((float)rxPackets);
+  if (wRstRxPackets != CAPS_SUCCESS) return wRstRxPackets;
+  int32_t wRstRxErrors = caps->write((float)rxErrors);
+  if (wRstRxErrors != CAPS_SUCCESS) return wRstRxErrors;
+  int32_t wRstRxDrops = caps->write((float)rxDrops);
+  if (wRstRxDrops != CAPS_SUCCESS) return wRstRxDrops;
+  int32_t wRstTxBytes = caps->write((float)txBytes);
+  if (wRstTxBytes != CAPS_SUCCESS) return wRstTxBytes;
+  int32_t wRstTxPackets = caps->write((float)txPackets);
+  if (wRstTxPackets != CAPS_SUCCESS) return wRstTxPackets;
+  int32_t wRstTxErrors = caps->write((float)txErrors);
+  if (wRstTxErrors != CAPS_SUCCESS) return wRstTxErrors;
+  int32_t wRstTxDrops = caps->write((float)txDrops);
+  if (wRstTxDrops != CAPS_SUCCESS) return wRstTxDrops;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t NetDevStat::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!interface) interface = std::make_shared<std::string>();
+  int32_t rRstInterface = caps->read_string(*interface);
+  if (rRstInterface != CAPS_SUCCESS) return rRstInterface;
+  int32_t rRstRxBytes = caps->read(rxBytes);
+  if (rRstRxBytes != CAPS_SUCCESS) return rRstRxBytes;
+  int32_t rRstRxPackets = caps->read(rxPackets);
+  if (rRstRxPackets != CAPS_SUCCESS) return rRstRxPackets;
+  int32_t rRstRxErrors = caps->read(rxErrors);
+  if (rRstRxErrors != CAPS_SUCCESS) return rRstRxErrors;
+  int32_t rRstRxDrops = caps->read(rxDrops);
+  if (rRstRxDrops != CAPS_SUCCESS) return rRstRxDrops;
+  int32_t rRstTxBytes = caps->read(txBytes);
+  if (rRstTxBytes != CAPS_SUCCESS) return rRstTxBytes;
+  int32_t rRstTxPackets = caps->read(txPackets);
+  if (rRstTxPackets != CAPS_SUCCESS) return rRstTxPackets;
+  int32_t rRstTxErrors = caps->read(txErrors);
+  if (rRstTxErrors != CAPS_SUCCESS) return rRstTxErrors;
+  int32_t rRstTxDrops = caps->read(txDrops);
+  if (rRstTxDrops != CAPS_SUCCESS) return rRstTxDrops;
+  return CAPS_SUCCESS;
+}
+
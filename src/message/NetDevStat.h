@@ -0,0 +1,168 @@
+#ifndef _NETDEVSTAT_H
+#define _NETDEVSTAT_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * traffic of one network interface
+   */
+  class NetDevStat {
+  private:
+    std::shared_ptr<std::string> interface = nullptr;
+    float rxBytes = 0;
+    float rxPackets = 0;
+    float rxErrors = 0;
+    float rxDrops = 0;
+    float txBytes = 0;
+    float txPackets = 0;
+    float txErrors = 0;
+    float txDrops = 0;
+  public:
+    inline static std::shared_ptr<NetDevStat> create() {
+      return std::make_shared<NetDevStat>();
+    }
+    /*
+    * getter interface name
+    */
+    inline const std::shared_ptr<std::string> getInterface() const {
+      return interface;
+    }
+    /*
+    * getter bytes received per second
+    */
+    inline float getRxBytes() const {
+      return rxBytes;
+    }
+    /*
+    * getter packets received per second
+    */
+    inline float getRxPackets() const {
+      return rxPackets;
+    }
+    /*
+    * getter receive errors per second
+    */
+    inline float getRxErrors() const {
+      return rxErrors;
+    }
+    /*
+    * getter received packets dropped per second
+    */
+    inline float getRxDrops() const {
+      return rxDrops;
+    }
+    /*
+    * getter bytes sent per second
+    */
+    inline float getTxBytes() const {
+      return txBytes;
+    }
+    /*
+    * getter packets sent per second
+    */
+    inline float getTxPackets() const {
+      return txPackets;
+    }
+    /*
+    * getter transmit errors per second
+    */
+    inline float getTxErrors() const {
+      return txErrors;
+    }
+    /*
+    * getter sent packets dropped per second
+    */
+    inline float getTxDrops() const {
+      return txDrops;
+    }
+    /*
+    * setter interface name
+    */
+    inline void setInterface(const std::shared_ptr<std::string> &v) {
+      interface = v;
+    }
+    /*
+    * setter interface name
+    */
+    inline void setInterface(const char* v) {
+      if (!interface) interface = std::make_shared<std::string>();
+      *interface = v;
+    }
+    /*
+    * setter bytes received per second
+    */
+    inline void setRxBytes(float v) {
+      rxBytes = v;
+    }
+    /*
+    * setter packets received per second
+    */
+    inline void setRxPackets(float v) {
+      rxPackets = v;
+    }
+    /*
+    * setter receive errors per second
+    */
+    inline void setRxErrors(float v) {
+      rxErrors = v;
+    }
+    /*
+    * setter received packets dropped per second
+    */
+    inline void setRxDrops(float v) {
+      rxDrops = v;
+    }
+    /*
+    * setter bytes sent per second
+    */
+    inline void setTxBytes(float v) {
+      txBytes = v;
+    }
+    /*
+    * setter packets sent per second
+    */
+    inline void setTxPackets(float v) {
+      txPackets = v;
+    }
+    /*
+    * setter transmit errors per second
+    */
+    inline void setTxErrors(float v) {
+      txErrors = v;
+    }
+    /*
+    * setter sent packets dropped per second
+    */
+    inline void setTxDrops(float v) {
+      txDrops = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _NETDEVSTAT_H
\ No newline at end of file
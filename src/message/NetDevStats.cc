@@ -0,0 +1,151 @@
+#include "NetDevStats.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t NetDevStats::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_NETDEVSTATS));
+  if (!interfaces)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)interfaces->size());
+    for(auto &v : *interfaces) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t NetDevStats::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_NETDEVSTATS));
+  if (!interfaces)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)interfaces->size());
+    for(auto &v : *interfaces) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t NetDevStats::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeInterfaces = 0;
+  int32_t rRstInterfaces = caps->read(arraySizeInterfaces);
+  if (rRstInterfaces != CAPS_SUCCESS) return rRstInterfaces;
+  if (!interfaces)
+    interfaces = std::make_shared<std::vector<NetDevStat>>();
+  else
+    interfaces->clear();
+  for(int32_t i = 0; i < arraySizeInterfaces;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      interfaces->emplace_back();
+      int32_t dRst = interfaces->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t NetDevStats::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeInterfaces = 0;
+  int32_t rRstInterfaces = caps->read(arraySizeInterfaces);
+  if (rRstInterfaces != CAPS_SUCCESS) return rRstInterfaces;
+  if (!interfaces)
+    interfaces = std::make_shared<std::vector<NetDevStat>>();
+  else
+    interfaces->clear();
+  for(int32_t i = 0; i < arraySizeInterfaces;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      interfaces->emplace_back();
+      int32_t dRst = interfaces->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t NetDevStats::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!interfaces)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)interfaces->size());
+    for(auto &v : *interfaces) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t NetDevStats::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeInterfaces = 0;
+  int32_t rRstInterfaces = caps->read(arraySizeInterfaces);
+  if (rRstInterfaces != CAPS_SUCCESS) return rRstInterfaces;
+  if (!interfaces)
+    interfaces = std::make_shared<std::vector<NetDevStat>>();
+  else
+    interfaces->clear();
+  for(int32_t i = 0; i < arraySizeInterfaces;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      interfaces->emplace_back();
+      int32_t dRst = interfaces->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,71 @@
+#ifndef _NETDEVSTATS_H
+#define _NETDEVSTATS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "NetDevStat.h"
+namespace rokid {
+  /*
+   * network interface traffic from /proc/net/dev
+   */
+  class NetDevStats {
+  private:
+    std::shared_ptr<std::vector<NetDevStat>> interfaces = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<NetDevStats> create() {
+      return std::make_shared<NetDevStats>();
+    }
+    /*
+    * getter interfaces with traffic
+    */
+    inline const std::shared_ptr<std::vector<NetDevStat>> getInterfaces() const {
+      return interfaces;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter interfaces with traffic
+    */
+    inline void setInterfaces(const std::shared_ptr<std::vector<NetDevStat>> &v) {
+      this->interfaces = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _NETDEVSTATS_H
\ No newline at end of file
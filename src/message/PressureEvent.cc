@@ -0,0 +1,130 @@
+#include "PressureEvent.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t PressureEvent::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PRESSUREEVENT));
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstStall = caps->write((int64_t)stall);
+  if (wRstStall != CAPS_SUCCESS) return wRstStall;
+  int32_t wRstWindow = caps->write((int64_t)window);
+  if (wRstWindow != CAPS_SUCCESS) return wRstWindow;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t PressureEvent::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PRESSUREEVENT));
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstStall = caps->write((int64_t)stall);
+  if (wRstStall != CAPS_SUCCESS) return wRstStall;
+  int32_t wRstWindow = caps->write((int64_t)window);
+  if (wRstWindow != CAPS_SUCCESS) return wRstWindow;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t PressureEvent::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstStall = caps->read(stall);
+  if (rRstStall != CAPS_SUCCESS) return rRstStall;
+  int32_t rRstWindow = caps->read(window);
+  if (rRstWindow != CAPS_SUCCESS) return rRstWindow;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t PressureEvent::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstStall = caps->read(stall);
+  if (rRstStall != CAPS_SUCCESS) return rRstStall;
+  int32_t rRstWindow = caps->read(window);
+  if (rRstWindow != CAPS_SUCCESS) return rRstWindow;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t PressureEvent::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstStall = caps->write((int64_t)stall);
+  if (wRstStall != CAPS_SUCCESS) return wRstStall;
+  int32_t wRstWindow = caps->write((int64_t)window);
+  if (wRstWindow != CAPS_SUCCESS) return wRstWindow;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t PressureEvent::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstStall = caps->read(stall);
+  if (rRstStall != CAPS_SUCCESS) return rRstStall;
+  int32_t rRstWindow = caps->read(window);
+  if (rRstWindow != CAPS_SUCCESS) return rRstWindow;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,129 @@
+#ifndef _PRESSUREEVENT_H
+#define _PRESSUREEVENT_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * pressure stall trigger fired
+   */
+  class PressureEvent {
+  private:
+    std::shared_ptr<std::string> resource = nullptr;
+    int64_t stall = 0;
+    int64_t window = 0;
+    float someAvg10 = 0;
+    float fullAvg10 = 0;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<PressureEvent> create() {
+      return std::make_shared<PressureEvent>();
+    }
+    /*
+    * getter cpu, memory or io
+    */
+    inline const std::shared_ptr<std::string> getResource() const {
+      return resource;
+    }
+    /*
+    * getter trigger stall threshold(us)
+    */
+    inline int64_t getStall() const {
+      return stall;
+    }
+    /*
+    * getter trigger window(us)
+    */
+    inline int64_t getWindow() const {
+      return window;
+    }
+    /*
+    * getter percent of time some tasks stalled, 10s average
+    */
+    inline float getSomeAvg10() const {
+      return someAvg10;
+    }
+    /*
+    * getter percent of time all tasks stalled, 10s average
+    */
+    inline float getFullAvg10() const {
+      return fullAvg10;
+    }
+    /*
+    * getter event time
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter cpu, memory or io
+    */
+    inline void setResource(const std::shared_ptr<std::string> &v) {
+      resource = v;
+    }
+    /*
+    * setter cpu, memory or io
+    */
+    inline void setResource(const char* v) {
+      if (!resource) resource = std::make_shared<std::string>();
+      *resource = v;
+    }
+    /*
+    * setter trigger stall threshold(us)
+    */
+    inline void setStall(int64_t v) {
+      stall = v;
+    }
+    /*
+    * setter trigger window(us)
+    */
+    inline void setWindow(int64_t v) {
+      window = v;
+    }
+    /*
+    * setter percent of time some tasks stalled, 10s average
+    */
+    inline void setSomeAvg10(float v) {
+      someAvg10 = v;
+    }
+    /*
+    * setter percent of time all tasks stalled, 10s average
+    */
+    inline void setFullAvg10(float v) {
+      fullAvg10 = v;
+    }
+    /*
+    * setter event time
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _PRESSUREEVENT_H
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "PressureInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t PressureInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PRESSUREINFO));
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstSomeAvg60 = caps->write((float)someAvg60);
+  if (wRstSomeAvg60 != CAPS_SUCCESS) return wRstSomeAvg60;
+  int32_t wRstSomeTotal = caps->write((int64_t)someTotal);
+  if (wRstSomeTotal != CAPS_SUCCESS) return wRstSomeTotal;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstFullAvg60 = caps->write((float)fullAvg60);
+  if (wRstFullAvg60 != CAPS_SUCCESS) return wRstFullAvg60;
+  int32_t wRstFullTotal = caps->write((int64_t)fullTotal);
+  if (wRstFullTotal != CAPS_SUCCESS) return wRstFullTotal;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t PressureInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PRESSUREINFO));
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstSomeAvg60 = caps->write((float)someAvg60);
+  if (wRstSomeAvg60 != CAPS_SUCCESS) return wRstSomeAvg60;
+  int32_t wRstSomeTotal = caps->write((int64_t)someTotal);
+  if (wRstSomeTotal != CAPS_SUCCESS) return wRstSomeTotal;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstFullAvg60 = caps->write((float)fullAvg60);
+  if (wRstFullAvg60 != CAPS_SUCCESS) return wRstFullAvg60;
+  int32_t wRstFullTotal = caps->write((int64_t)fullTotal);
+  if (wRstFullTotal != CAPS_SUCCESS) return wRstFullTotal;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t PressureInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstSomeAvg60 = caps->read(someAvg60);
+  if (rRstSomeAvg60 != CAPS_SUCCESS) return rRstSomeAvg60;
+  int32_t rRstSomeTotal = caps->read(someTotal);
+  if (rRstSomeTotal != CAPS_SUCCESS) return rRstSomeTotal;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstFullAvg60 = caps->read(fullAvg60);
+  if (rRstFullAvg60 != CAPS_SUCCESS) return rRstFullAvg60;
+  int32_t rRstFullTotal = caps->read(fullTotal);
+  if (rRstFullTotal != CAPS_SUCCESS) return rRstFullTotal;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t PressureInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstSomeAvg60 = caps->read(someAvg60);
+  if (rRstSomeAvg60 != CAPS_SUCCESS) return rRstSomeAvg60;
+  int32_t rRstSomeTotal = caps->read(someTotal);
+  if (rRstSomeTotal != CAPS_SUCCESS) return rRstSomeTotal;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstFullAvg60 = caps->read(fullAvg60);
+  if (rRstFullAvg60 != CAPS_SUCCESS) return rRstFullAvg60;
+  int32_t rRstFullTotal = caps->read(fullTotal);
+  if (rRstFullTotal != CAPS_SUCCESS) return rRstFullTotal;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t PressureInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstResource;
+  assert(resource);
+  wRstResource = caps->write(resource->c_str());
+  if (wRstResource != CAPS_SUCCESS) return wRstResource;
+  int32_t wRstSomeAvg10 = caps->write((float)someAvg10);
+  if (wRstSomeAvg10 != CAPS_SUCCESS) return wRstSomeAvg10;
+  int32_t wRstSomeAvg60 = caps->write((float)someAvg60);
+  if (wRstSomeAvg60 != CAPS_SUCCESS) return wRstSomeAvg60;
+  int32_t wRstSomeTotal = caps->write((int64_t)someTotal);
+  if (wRstSomeTotal != CAPS_SUCCESS) return wRstSomeTotal;
+  int32_t wRstFullAvg10 = caps->write((float)fullAvg10);
+  if (wRstFullAvg10 != CAPS_SUCCESS) return wRstFullAvg10;
+  int32_t wRstFullAvg60 = caps->write((float)fullAvg60);
+  if (wRstFullAvg60 != CAPS_SUCCESS) return wRstFullAvg60;
+  int32_t wRstFullTotal = caps->write((int64_t)fullTotal);
+  if (wRstFullTotal != CAPS_SUCCESS) return wRstFullTotal;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t PressureInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!resource) resource = std::make_shared<std::string>();
+  int32_t rRstResource = caps->read_string(*resource);
+  if (rRstResource != CAPS_SUCCESS) return rRstResource;
+  int32_t rRstSomeAvg10 = caps->read(someAvg10);
+  if (rRstSomeAvg10 != CAPS_SUCCESS) return rRstSomeAvg10;
+  int32_t rRstSomeAvg60 = caps->read(someAvg60);
+  if (rRstSomeAvg60 != CAPS_SUCCESS) return rRstSomeAvg60;
+  int32_t rRstSomeTotal = caps->read(someTotal);
+  if (rRstSomeTotal != CAPS_SUCCESS) return rRstSomeTotal;
+  int32_t rRstFullAvg10 = caps->read(fullAvg10);
+  if (rRstFullAvg10 != CAPS_SUCCESS) return rRstFullAvg10;
+  int32_t rRstFullAvg60 = caps->read(fullAvg60);
+  if (rRstFullAvg60 != CAPS_SUCCESS) return rRstFullAvg60;
+  int32_t rRstFullTotal = caps->read(fullTotal);
+  if (rRstFullTotal != CAPS_SUCCESS) return rRstFullTotal;
+  return CAPS_SUCCESS;
+}
+
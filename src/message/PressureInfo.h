@@ -0,0 +1,142 @@
+#ifndef _PRESSUREINFO_H
+#define _PRESSUREINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * pressure stall information of one resource
+   */
+  class PressureInfo {
+  private:
+    std::shared_ptr<std::string> resource = nullptr;
+    float someAvg10 = 0;
+    float someAvg60 = 0;
+    int64_t someTotal = 0;
+    float fullAvg10 = 0;
+    float fullAvg60 = 0;
+    int64_t fullTotal = 0;
+  public:
+    inline static std::shared_ptr<PressureInfo> create() {
+      return std::make_shared<PressureInfo>();
+    }
+    /*
+    * getter cpu, memory or io
+    */
+    inline const std::shared_ptr<std::string> getResource() const {
+      return resource;
+    }
+    /*
+    * getter percent of time some tasks stalled, 10s average
+    */
+    inline float getSomeAvg10() const {
+      return someAvg10;
+    }
+    /*
+    * getter percent of time some tasks stalled, 60s average
+    */
+    inline float getSomeAvg60() const {
+      return someAvg60;
+    }
+    /*
+    * getter some stall time since last collect(us)
+    */
+    inline int64_t getSomeTotal() const {
+      return someTotal;
+    }
+    /*
+    * getter percent of time all tasks stalled, 10s average
+    */
+    inline float getFullAvg10() const {
+      return fullAvg10;
+    }
+    /*
+    * getter percent of time all tasks stalled, 60s average
+    */
+    inline float getFullAvg60() const {
+      return fullAvg60;
+    }
+    /*
+    * getter full stall time since last collect(us)
+    */
+    inline int64_t getFullTotal() const {
+      return fullTotal;
+    }
+    /*
+    * setter cpu, memory or io
+    */
+    inline void setResource(const std::shared_ptr<std::string> &v) {
+      resource = v;
+    }
+    /*
+    * setter cpu, memory or io
+    */
+    inline void setResource(const char* v) {
+      if (!resource) resource = std::make_shared<std::string>();
+      *resource = v;
+    }
+    /*
+    * setter percent of time some tasks stalled, 10s average
+    */
+    inline void setSomeAvg10(float v) {
+      someAvg10 = v;
+    }
+    /*
+    * setter percent of time some tasks stalled, 60s average
+    */
+    inline void setSomeAvg60(float v) {
+      someAvg60 = v;
+    }
+    /*
+    * setter some stall time since last collect(us)
+    */
+    inline void setSomeTotal(int64_t v) {
+      someTotal = v;
+    }
+    /*
+    * setter percent of time all tasks stalled, 10s average
+    */
+    inline void setFullAvg10(float v) {
+      fullAvg10 = v;
+    }
+    /*
+    * setter percent of time all tasks stalled, 60s average
+    */
+    inline void setFullAvg60(float v) {
+      fullAvg60 = v;
+    }
+    /*
+    * setter full stall time since last collect(us)
+    */
+    inline void setFullTotal(int64_t v) {
+      fullTotal = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _PRESSUREINFO_H
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef _PRESSUREINFOS_H
+#define _PRESSUREINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "PressureInfo.h"
+namespace rokid {
+  /*
+   * pressure stall information
+   */
+  class PressureInfos {
+  private:
+    std::shared_ptr<std::vector<PressureInfo>> pressures = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<PressureInfos> create() {
+      return std::make_shared<PressureInfos>();
+    }
+    /*
+    * getter per resource
+    */
+    inline const std::shared_ptr<std::vector<PressureInfo>> getPressures() const {
+      return pressures;
+    }
+    /*
+    * getter collect time
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter per resource
+    */
+    inline void setPressures(const std::shared_ptr<std::vector<PressureInfo>> &v) {
+      this->pressures = v;
+    }
+    /*
+    * setter collect time
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _PRESSUREINFOS_H
\ No newline at end of file
@@ -27,6 +27,14 @@ int32_t ProcCPUInfo::serialize(void* buf, uint32_t bufsize) const {
   if (wRstNice != CAPS_SUCCESS) return wRstNice;
   int32_t wRstCpuUsage = caps->write((float)cpuUsage);
   if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstMinFltRate = caps->write((float)minFltRate);
+  if (wRstMinFltRate != CAPS_SUCCESS) return wRstMinFltRate;
+  int32_t wRstMajFltRate = caps->write((float)majFltRate);
+  if (wRstMajFltRate != CAPS_SUCCESS) return wRstMajFltRate;
+  int32_t wRstNvcswRate = caps->write((float)nvcswRate);
+  if (wRstNvcswRate != CAPS_SUCCESS) return wRstNvcswRate;
+  int32_t wRstNivcswRate = caps->write((float)nivcswRate);
+  if (wRstNivcswRate != CAPS_SUCCESS) return wRstNivcswRate;
   return caps->serialize(buf, bufsize);
 }
 /*
@@ -56,6 +64,14 @@ int32_t ProcCPUInfo::serialize(std::shared_ptr<Caps> &caps) const {
   if (wRstNice != CAPS_SUCCESS) return wRstNice;
   int32_t wRstCpuUsage = caps->write((float)cpuUsage);
   if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstMinFltRate = caps->write((float)minFltRate);
+  if (wRstMinFltRate != CAPS_SUCCESS) return wRstMinFltRate;
+  int32_t wRstMajFltRate = caps->write((float)majFltRate);
+  if (wRstMajFltRate != CAPS_SUCCESS) return wRstMajFltRate;
+  int32_t wRstNvcswRate = caps->write((float)nvcswRate);
+  if (wRstNvcswRate != CAPS_SUCCESS) return wRstNvcswRate;
+  int32_t wRstNivcswRate = caps->write((float)nivcswRate);
+  if (wRstNivcswRate != CAPS_SUCCESS) return wRstNivcswRate;
   return CAPS_SUCCESS;
 }
 /*
@@ -83,6 +99,14 @@ int32_t ProcCPUInfo::deserialize(void* buf, uint32_t bufSize) {
   if (rRstNice != CAPS_SUCCESS) return rRstNice;
   int32_t rRstCpuUsage = caps->read(cpuUsage);
   if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstMinFltRate = caps->read(minFltRate);
+  if (rRstMinFltRate != CAPS_SUCCESS) return rRstMinFltRate;
+  int32_t rRstMajFltRate = caps->read(majFltRate);
+  if (rRstMajFltRate != CAPS_SUCCESS) return rRstMajFltRate;
+  int32_t rRstNvcswRate = caps->read(nvcswRate);
+  if (rRstNvcswRate != CAPS_SUCCESS) return rRstNvcswRate;
+  int32_t rRstNivcswRate = caps->read(nivcswRate);
+  if (rRstNivcswRate != CAPS_SUCCESS) return rRstNivcswRate;
   return CAPS_SUCCESS;
 }
 /*
@@ -107,6 +131,14 @@ int32_t ProcCPUInfo::deserialize(std::shared_ptr<Caps> &caps) {
   if (rRstNice != CAPS_SUCCESS) return rRstNice;
   int32_t rRstCpuUsage = caps->read(cpuUsage);
   if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstMinFltRate = caps->read(minFltRate);
+  if (rRstMinFltRate != CAPS_SUCCESS) return rRstMinFltRate;
+  int32_t rRstMajFltRate = caps->read(majFltRate);
+  if (rRstMajFltRate != CAPS_SUCCESS) return rRstMajFltRate;
+  int32_t rRstNvcswRate = caps->read(nvcswRate);
+  if (rRstNvcswRate != CAPS_SUCCESS) return rRstNvcswRate;
+  int32_t rRstNivcswRate = caps->read(nivcswRate);
+  if (rRstNivcswRate != CAPS_SUCCESS) return rRstNivcswRate;
   return CAPS_SUCCESS;
 }
 /*
@@ -134,6 +166,14 @@ int32_t ProcCPUInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
   if (wRstNice != CAPS_SUCCESS) return wRstNice;
   int32_t wRstCpuUsage = caps->write((float)cpuUsage);
   if (wRstCpuUsage != CAPS_SUCCESS) return wRstCpuUsage;
+  int32_t wRstMinFltRate = caps->write((float)minFltRate);
+  if (wRstMinFltRate != CAPS_SUCCESS) return wRstMinFltRate;
+  int32_t wRstMajFltRate = caps->write((float)majFltRate);
+  if (wRstMajFltRate != CAPS_SUCCESS) return wRstMajFltRate;
+  int32_t wRstNvcswRate = caps->write((float)nvcswRate);
+  if (wRstNvcswRate != CAPS_SUCCESS) return wRstNvcswRate;
+  int32_t wRstNivcswRate = caps->write((float)nivcswRate);
+  if (wRstNivcswRate != CAPS_SUCCESS) return wRstNivcswRate;
   return CAPS_SUCCESS;
 }
 /*
@@ -158,6 +198,14 @@ int32_t ProcCPUInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
   if (rRstNice != CAPS_SUCCESS) return rRstNice;
   int32_t rRstCpuUsage = caps->read(cpuUsage);
   if (rRstCpuUsage != CAPS_SUCCESS) return rRstCpuUsage;
+  int32_t rRstMinFltRate = caps->read(minFltRate);
+  if (rRstMinFltRate != CAPS_SUCCESS) return rRstMinFltRate;
+  int32_t rRstMajFltRate = caps->read(majFltRate);
+  if (rRstMajFltRate != CAPS_SUCCESS) return rRstMajFltRate;
+  int32_t rRstNvcswRate = caps->read(nvcswRate);
+  if (rRstNvcswRate != CAPS_SUCCESS) return rRstNvcswRate;
+  int32_t rRstNivcswRate = caps->read(nivcswRate);
+  if (rRstNivcswRate != CAPS_SUCCESS) return rRstNivcswRate;
   return CAPS_SUCCESS;
 }
 
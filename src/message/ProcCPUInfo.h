@@ -18,6 +18,10 @@ namespace rokid {
     int64_t ticks = 0;
     int32_t nice = 0;
     float cpuUsage = 0;
+    float minFltRate = 0;
+    float majFltRate = 0;
+    float nvcswRate = 0;
+    float nivcswRate = 0;
   public:
     inline static std::shared_ptr<ProcCPUInfo> create() {
       return std::make_shared<ProcCPUInfo>();
@@ -71,6 +75,30 @@ namespace rokid {
       return cpuUsage;
     }
     /*
+    * getter minor faults per second
+    */
+    inline float getMinFltRate() const {
+      return minFltRate;
+    }
+    /*
+    * getter major faults per second
+    */
+    inline float getMajFltRate() const {
+      return majFltRate;
+    }
+    /*
+    * getter voluntary context switches per second, 0 unless on cpu in the last two ticks
+    */
+    inline float getNvcswRate() const {
+      return nvcswRate;
+    }
+    /*
+    * getter involuntary context switches per second, 0 unless on cpu in the last two ticks
+    */
+    inline float getNivcswRate() const {
+      return nivcswRate;
+    }
+    /*
     * setter process id
     */
     inline void setPid(uint32_t v) {
@@ -132,6 +160,30 @@ namespace rokid {
     inline void setCpuUsage(float v) {
       cpuUsage = v;
     }
+    /*
+    * setter minor faults per second
+    */
+    inline void setMinFltRate(float v) {
+      minFltRate = v;
+    }
+    /*
+    * setter major faults per second
+    */
+    inline void setMajFltRate(float v) {
+      majFltRate = v;
+    }
+    /*
+    * setter voluntary context switches per second, 0 unless on cpu in the last two ticks
+    */
+    inline void setNvcswRate(float v) {
+      nvcswRate = v;
+    }
+    /*
+    * setter involuntary context switches per second, 0 unless on cpu in the last two ticks
+    */
+    inline void setNivcswRate(float v) {
+      nivcswRate = v;
+    }
     /*
      * serialize this object as buffer
     */
@@ -0,0 +1,142 @@
+#include "ProcIOInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t ProcIOInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PROCIOINFO));
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstCancelledWriteBytes = caps->write((float)cancelledWriteBytes);
+  if (wRstCancelledWriteBytes != CAPS_SUCCESS) return wRstCancelledWriteBytes;
+  int32_t wRstSyscr = caps->write((float)syscr);
+  if (wRstSyscr != CAPS_SUCCESS) return wRstSyscr;
+  int32_t wRstSyscw = caps->write((float)syscw);
+  if (wRstSyscw != CAPS_SUCCESS) return wRstSyscw;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t ProcIOInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_PROCIOINFO));
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstCancelledWriteBytes = caps->write((float)cancelledWriteBytes);
+  if (wRstCancelledWriteBytes != CAPS_SUCCESS) return wRstCancelledWriteBytes;
+  int32_t wRstSyscr = caps->write((float)syscr);
+  if (wRstSyscr != CAPS_SUCCESS) return wRstSyscr;
+  int32_t wRstSyscw = caps->write((float)syscw);
+  if (wRstSyscw != CAPS_SUCCESS) return wRstSyscw;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t ProcIOInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstCancelledWriteBytes = caps->read(cancelledWriteBytes);
+  if (rRstCancelledWriteBytes != CAPS_SUCCESS) return rRstCancelledWriteBytes;
+  int32_t rRstSyscr = caps->read(syscr);
+  if (rRstSyscr != CAPS_SUCCESS) return rRstSyscr;
+  int32_t rRstSyscw = caps->read(syscw);
+  if (rRstSyscw != CAPS_SUCCESS) return rRstSyscw;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t ProcIOInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstCancelledWriteBytes = caps->read(cancelledWriteBytes);
+  if (rRstCancelledWriteBytes != CAPS_SUCCESS) return rRstCancelledWriteBytes;
+  int32_t rRstSyscr = caps->read(syscr);
+  if (rRstSyscr != CAPS_SUCCESS) return rRstSyscr;
+  int32_t rRstSyscw = caps->read(syscw);
+  if (rRstSyscw != CAPS_SUCCESS) return rRstSyscw;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t ProcIOInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstReadBytes = caps->write((float)readBytes);
+  if (wRstReadBytes != CAPS_SUCCESS) return wRstReadBytes;
+  int32_t wRstWriteBytes = caps->write((float)writeBytes);
+  if (wRstWriteBytes != CAPS_SUCCESS) return wRstWriteBytes;
+  int32_t wRstCancelledWriteBytes = caps->write((float)cancelledWriteBytes);
+  if (wRstCancelledWriteBytes != CAPS_SUCCESS) return wRstCancelledWriteBytes;
+  int32_t wRstSyscr = caps->write((float)syscr);
+  if (wRstSyscr != CAPS_SUCCESS) return wRstSyscr;
+  int32_t wRstSyscw = caps->write((float)syscw);
+  if (wRstSyscw != CAPS_SUCCESS) return wRstSyscw;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t ProcIOInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstReadBytes = caps->read(readBytes);
+  if (rRstReadBytes != CAPS_SUCCESS) return rRstReadBytes;
+  int32_t rRstWriteBytes = caps->read(writeBytes);
+  if (rRstWriteBytes != CAPS_SUCCESS) return rRstWriteBytes;
+  int32_t rRstCancelledWriteBytes = caps->read(cancelledWriteBytes);
+  if (rRstCancelledWriteBytes != CAPS_SUCCESS) return rRstCancelledWriteBytes;
+  int32_t rRstSyscr = caps->read(syscr);
+  if (rRstSyscr != CAPS_SUCCESS) return rRstSyscr;
+  int32_t rRstSyscw = caps->read(syscw);
+  if (rRstSyscw != CAPS_SUCCESS) return rRstSyscw;
+  return CAPS_SUCCESS;
+}
+
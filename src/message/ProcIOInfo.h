@@ -0,0 +1,142 @@
+#ifndef _PROCIOINFO_H
+#define _PROCIOINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * process io from /proc/<pid>/io
+   */
+  class ProcIOInfo {
+  private:
+    uint32_t pid = 0;
+    std::shared_ptr<std::string> fullName = nullptr;
+    float readBytes = 0;
+    float writeBytes = 0;
+    float cancelledWriteBytes = 0;
+    float syscr = 0;
+    float syscw = 0;
+  public:
+    inline static std::shared_ptr<ProcIOInfo> create() {
+      return std::make_shared<ProcIOInfo>();
+    }
+    /*
+    * getter process id
+    */
+    inline uint32_t getPid() const {
+      return pid;
+    }
+    /*
+    * getter process command line
+    */
+    inline const std::shared_ptr<std::string> getFullName() const {
+      return fullName;
+    }
+    /*
+    * getter bytes fetched from storage per second
+    */
+    inline float getReadBytes() const {
+      return readBytes;
+    }
+    /*
+    * getter bytes sent to storage per second
+    */
+    inline float getWriteBytes() const {
+      return writeBytes;
+    }
+    /*
+    * getter written bytes truncated before writeback per second
+    */
+    inline float getCancelledWriteBytes() const {
+      return cancelledWriteBytes;
+    }
+    /*
+    * getter read syscalls per second
+    */
+    inline float getSyscr() const {
+      return syscr;
+    }
+    /*
+    * getter write syscalls per second
+    */
+    inline float getSyscw() const {
+      return syscw;
+    }
+    /*
+    * setter process id
+    */
+    inline void setPid(uint32_t v) {
+      pid = v;
+    }
+    /*
+    * setter process command line
+    */
+    inline void setFullName(const std::shared_ptr<std::string> &v) {
+      fullName = v;
+    }
+    /*
+    * setter process command line
+    */
+    inline void setFullName(const char* v) {
+      if (!fullName) fullName = std::make_shared<std::string>();
+      *fullName = v;
+    }
+    /*
+    * setter bytes fetched from storage per second
+    */
+    inline void setReadBytes(float v) {
+      readBytes = v;
+    }
+    /*
+    * setter bytes sent to storage per second
+    */
+    inline void setWriteBytes(float v) {
+      writeBytes = v;
+    }
+    /*
+    * setter written bytes truncated before writeback per second
+    */
+    inline void setCancelledWriteBytes(float v) {
+      cancelledWriteBytes = v;
+    }
+    /*
+    * setter read syscalls per second
+    */
+    inline void setSyscr(float v) {
+      syscr = v;
+    }
+    /*
+    * setter write syscalls per second
+    */
+    inline void setSyscw(float v) {
+      syscw = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _PROCIOINFO_H
\ No newline at end of file
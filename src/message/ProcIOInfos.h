@@ -0,0 +1,71 @@
+#ifndef _PROCIOINFOS_H
+#define _PROCIOINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "ProcIOInfo.h"
+namespace rokid {
+  /*
+   * io of the processes busiest on cpu, ordered by storage bytes
+   */
+  class ProcIOInfos {
+  private:
+    std::shared_ptr<std::vector<ProcIOInfo>> procIoList = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<ProcIOInfos> create() {
+      return std::make_shared<ProcIOInfos>();
+    }
+    /*
+    * getter processes with io
+    */
+    inline const std::shared_ptr<std::vector<ProcIOInfo>> getProcIoList() const {
+      return procIoList;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter processes with io
+    */
+    inline void setProcIoList(const std::shared_ptr<std::vector<ProcIOInfo>> &v) {
+      this->procIoList = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _PROCIOINFOS_H
\ No newline at end of file
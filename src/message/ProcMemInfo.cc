@@ -25,6 +25,10 @@ int32_t ProcMemInfo::serialize(void* buf, uint32_t bufsize) const {
   if (wRstPss != CAPS_SUCCESS) return wRstPss;
   int32_t wRstRss = caps->write((int64_t)rss);
   if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstCached = caps->write((int32_t)cached);
+  if (wRstCached != CAPS_SUCCESS) return wRstCached;
   return caps->serialize(buf, bufsize);
 }
 /*
@@ -52,6 +56,10 @@ int32_t ProcMemInfo::serialize(std::shared_ptr<Caps> &caps) const {
   if (wRstPss != CAPS_SUCCESS) return wRstPss;
   int32_t wRstRss = caps->write((int64_t)rss);
   if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstCached = caps->write((int32_t)cached);
+  if (wRstCached != CAPS_SUCCESS) return wRstCached;
   return CAPS_SUCCESS;
 }
 /*
@@ -78,6 +86,10 @@ int32_t ProcMemInfo::deserialize(void* buf, uint32_t bufSize) {
   if (rRstPss != CAPS_SUCCESS) return rRstPss;
   int32_t rRstRss = caps->read(rss);
   if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstCached = caps->read(cached);
+  if (rRstCached != CAPS_SUCCESS) return rRstCached;
   return CAPS_SUCCESS;
 }
 /*
@@ -101,6 +113,10 @@ int32_t ProcMemInfo::deserialize(std::shared_ptr<Caps> &caps) {
   if (rRstPss != CAPS_SUCCESS) return rRstPss;
   int32_t rRstRss = caps->read(rss);
   if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstCached = caps->read(cached);
+  if (rRstCached != CAPS_SUCCESS) return rRstCached;
   return CAPS_SUCCESS;
 }
 /*
@@ -126,6 +142,10 @@ int32_t ProcMemInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
   if (wRstPss != CAPS_SUCCESS) return wRstPss;
   int32_t wRstRss = caps->write((int64_t)rss);
   if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstCached = caps->write((int32_t)cached);
+  if (wRstCached != CAPS_SUCCESS) return wRstCached;
   return CAPS_SUCCESS;
 }
 /*
@@ -149,6 +169,10 @@ int32_t ProcMemInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
   if (rRstPss != CAPS_SUCCESS) return rRstPss;
   int32_t rRstRss = caps->read(rss);
   if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstCached = caps->read(cached);
+  if (rRstCached != CAPS_SUCCESS) return rRstCached;
   return CAPS_SUCCESS;
 }
 
@@ -18,6 +18,8 @@ namespace rokid {
     int64_t privateDirty = 0;
     int64_t pss = 0;
     int64_t rss = 0;
+    int64_t swap = 0;
+    int32_t cached = 0;
   public:
     inline static std::shared_ptr<ProcMemInfo> create() {
       return std::make_shared<ProcMemInfo>();
@@ -71,6 +73,18 @@ namespace rokid {
       return rss;
     }
     /*
+    * getter swapped out size
+    */
+    inline int64_t getSwap() const {
+      return swap;
+    }
+    /*
+    * getter 1 if reused from an earlier scan as the process did not change
+    */
+    inline int32_t getCached() const {
+      return cached;
+    }
+    /*
     * setter process id
     */
     inline void setPid(uint32_t v) {
@@ -125,6 +139,18 @@ namespace rokid {
     inline void setRss(int64_t v) {
       rss = v;
     }
+    /*
+    * setter swapped out size
+    */
+    inline void setSwap(int64_t v) {
+      swap = v;
+    }
+    /*
+    * setter 1 if reused from an earlier scan as the process did not change
+    */
+    inline void setCached(int32_t v) {
+      cached = v;
+    }
     /*
      * serialize this object as buffer
     */
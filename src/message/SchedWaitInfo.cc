@@ -0,0 +1,130 @@
+#include "SchedWaitInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t SchedWaitInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SCHEDWAITINFO));
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstWaitMs = caps->write((float)waitMs);
+  if (wRstWaitMs != CAPS_SUCCESS) return wRstWaitMs;
+  int32_t wRstRunMs = caps->write((float)runMs);
+  if (wRstRunMs != CAPS_SUCCESS) return wRstRunMs;
+  int32_t wRstTimeslices = caps->write((uint32_t)timeslices);
+  if (wRstTimeslices != CAPS_SUCCESS) return wRstTimeslices;
+  int32_t wRstAvgWaitUs = caps->write((float)avgWaitUs);
+  if (wRstAvgWaitUs != CAPS_SUCCESS) return wRstAvgWaitUs;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t SchedWaitInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SCHEDWAITINFO));
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstWaitMs = caps->write((float)waitMs);
+  if (wRstWaitMs != CAPS_SUCCESS) return wRstWaitMs;
+  int32_t wRstRunMs = caps->write((float)runMs);
+  if (wRstRunMs != CAPS_SUCCESS) return wRstRunMs;
+  int32_t wRstTimeslices = caps->write((uint32_t)timeslices);
+  if (wRstTimeslices != CAPS_SUCCESS) return wRstTimeslices;
+  int32_t wRstAvgWaitUs = caps->write((float)avgWaitUs);
+  if (wRstAvgWaitUs != CAPS_SUCCESS) return wRstAvgWaitUs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t SchedWaitInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstWaitMs = caps->read(waitMs);
+  if (rRstWaitMs != CAPS_SUCCESS) return rRstWaitMs;
+  int32_t rRstRunMs = caps->read(runMs);
+  if (rRstRunMs != CAPS_SUCCESS) return rRstRunMs;
+  int32_t rRstTimeslices = caps->read(timeslices);
+  if (rRstTimeslices != CAPS_SUCCESS) return rRstTimeslices;
+  int32_t rRstAvgWaitUs = caps->read(avgWaitUs);
+  if (rRstAvgWaitUs != CAPS_SUCCESS) return rRstAvgWaitUs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t SchedWaitInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstWaitMs = caps->read(waitMs);
+  if (rRstWaitMs != CAPS_SUCCESS) return rRstWaitMs;
+  int32_t rRstRunMs = caps->read(runMs);
+  if (rRstRunMs != CAPS_SUCCESS) return rRstRunMs;
+  int32_t rRstTimeslices = caps->read(timeslices);
+  if (rRstTimeslices != CAPS_SUCCESS) return rRstTimeslices;
+  int32_t rRstAvgWaitUs = caps->read(avgWaitUs);
+  if (rRstAvgWaitUs != CAPS_SUCCESS) return rRstAvgWaitUs;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t SchedWaitInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstPid = caps->write((uint32_t)pid);
+  if (wRstPid != CAPS_SUCCESS) return wRstPid;
+  int32_t wRstFullName;
+  assert(fullName);
+  wRstFullName = caps->write(fullName->c_str());
+  if (wRstFullName != CAPS_SUCCESS) return wRstFullName;
+  int32_t wRstWaitMs = caps->write((float)waitMs);
+  if (wRstWaitMs != CAPS_SUCCESS) return wRstWaitMs;
+  int32_t wRstRunMs = caps->write((float)runMs);
+  if (wRstRunMs != CAPS_SUCCESS) return wRstRunMs;
+  int32_t wRstTimeslices = caps->write((uint32_t)timeslices);
+  if (wRstTimeslices != CAPS_SUCCESS) return wRstTimeslices;
+  int32_t wRstAvgWaitUs = caps->write((float)avgWaitUs);
+  if (wRstAvgWaitUs != CAPS_SUCCESS) return wRstAvgWaitUs;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t SchedWaitInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstPid = caps->read(pid);
+  if (rRstPid != CAPS_SUCCESS) return rRstPid;
+  if (!fullName) fullName = std::make_shared<std::string>();
+  int32_t rRstFullName = caps->read_string(*fullName);
+  if (rRstFullName != CAPS_SUCCESS) return rRstFullName;
+  int32_t rRstWaitMs = caps->read(waitMs);
+  if (rRstWaitMs != CAPS_SUCCESS) return rRstWaitMs;
+  int32_t rRstRunMs = caps->read(runMs);
+  if (rRstRunMs != CAPS_SUCCESS) return rRstRunMs;
+  int32_t rRstTimeslices = caps->read(timeslices);
+  if (rRstTimeslices != CAPS_SUCCESS) return rRstTimeslices;
+  int32_t rRstAvgWaitUs = caps->read(avgWaitUs);
+  if (rRstAvgWaitUs != CAPS_SUCCESS) return rRstAvgWaitUs;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,129 @@
+#ifndef _SCHEDWAITINFO_H
+#define _SCHEDWAITINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * runqueue wait of one process in a top tick
+   */
+  class SchedWaitInfo {
+  private:
+    uint32_t pid = 0;
+    std::shared_ptr<std::string> fullName = nullptr;
+    float waitMs = 0;
+    float runMs = 0;
+    uint32_t timeslices = 0;
+    float avgWaitUs = 0;
+  public:
+    inline static std::shared_ptr<SchedWaitInfo> create() {
+      return std::make_shared<SchedWaitInfo>();
+    }
+    /*
+    * getter process id
+    */
+    inline uint32_t getPid() const {
+      return pid;
+    }
+    /*
+    * getter process command line
+    */
+    inline const std::shared_ptr<std::string> getFullName() const {
+      return fullName;
+    }
+    /*
+    * getter milliseconds waiting on a runqueue in the tick
+    */
+    inline float getWaitMs() const {
+      return waitMs;
+    }
+    /*
+    * getter milliseconds on cpu in the tick
+    */
+    inline float getRunMs() const {
+      return runMs;
+    }
+    /*
+    * getter timeslices run in the tick
+    */
+    inline uint32_t getTimeslices() const {
+      return timeslices;
+    }
+    /*
+    * getter average microseconds waited before a timeslice
+    */
+    inline float getAvgWaitUs() const {
+      return avgWaitUs;
+    }
+    /*
+    * setter process id
+    */
+    inline void setPid(uint32_t v) {
+      pid = v;
+    }
+    /*
+    * setter process command line
+    */
+    inline void setFullName(const std::shared_ptr<std::string> &v) {
+      fullName = v;
+    }
+    /*
+    * setter process command line
+    */
+    inline void setFullName(const char* v) {
+      if (!fullName) fullName = std::make_shared<std::string>();
+      *fullName = v;
+    }
+    /*
+    * setter milliseconds waiting on a runqueue in the tick
+    */
+    inline void setWaitMs(float v) {
+      waitMs = v;
+    }
+    /*
+    * setter milliseconds on cpu in the tick
+    */
+    inline void setRunMs(float v) {
+      runMs = v;
+    }
+    /*
+    * setter timeslices run in the tick
+    */
+    inline void setTimeslices(uint32_t v) {
+      timeslices = v;
+    }
+    /*
+    * setter average microseconds waited before a timeslice
+    */
+    inline void setAvgWaitUs(float v) {
+      avgWaitUs = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _SCHEDWAITINFO_H
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "SchedWaitInfos.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t SchedWaitInfos::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SCHEDWAITINFOS));
+  if (!waiters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)waiters->size());
+    for(auto &v : *waiters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalWaitMs = caps->write((float)totalWaitMs);
+  if (wRstTotalWaitMs != CAPS_SUCCESS) return wRstTotalWaitMs;
+  int32_t wRstTickMs = caps->write((float)tickMs);
+  if (wRstTickMs != CAPS_SUCCESS) return wRstTickMs;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t SchedWaitInfos::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SCHEDWAITINFOS));
+  if (!waiters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)waiters->size());
+    for(auto &v : *waiters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalWaitMs = caps->write((float)totalWaitMs);
+  if (wRstTotalWaitMs != CAPS_SUCCESS) return wRstTotalWaitMs;
+  int32_t wRstTickMs = caps->write((float)tickMs);
+  if (wRstTickMs != CAPS_SUCCESS) return wRstTickMs;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t SchedWaitInfos::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeWaiters = 0;
+  int32_t rRstWaiters = caps->read(arraySizeWaiters);
+  if (rRstWaiters != CAPS_SUCCESS) return rRstWaiters;
+  if (!waiters)
+    waiters = std::make_shared<std::vector<SchedWaitInfo>>();
+  else
+    waiters->clear();
+  for(int32_t i = 0; i < arraySizeWaiters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      waiters->emplace_back();
+      int32_t dRst = waiters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalWaitMs = caps->read(totalWaitMs);
+  if (rRstTotalWaitMs != CAPS_SUCCESS) return rRstTotalWaitMs;
+  int32_t rRstTickMs = caps->read(tickMs);
+  if (rRstTickMs != CAPS_SUCCESS) return rRstTickMs;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t SchedWaitInfos::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeWaiters = 0;
+  int32_t rRstWaiters = caps->read(arraySizeWaiters);
+  if (rRstWaiters != CAPS_SUCCESS) return rRstWaiters;
+  if (!waiters)
+    waiters = std::make_shared<std::vector<SchedWaitInfo>>();
+  else
+    waiters->clear();
+  for(int32_t i = 0; i < arraySizeWaiters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      waiters->emplace_back();
+      int32_t dRst = waiters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalWaitMs = caps->read(totalWaitMs);
+  if (rRstTotalWaitMs != CAPS_SUCCESS) return rRstTotalWaitMs;
+  int32_t rRstTickMs = caps->read(tickMs);
+  if (rRstTickMs != CAPS_SUCCESS) return rRstTickMs;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t SchedWaitInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!waiters)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)waiters->size());
+    for(auto &v : *waiters) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalWaitMs = caps->write((float)totalWaitMs);
+  if (wRstTotalWaitMs != CAPS_SUCCESS) return wRstTotalWaitMs;
+  int32_t wRstTickMs = caps->write((float)tickMs);
+  if (wRstTickMs != CAPS_SUCCESS) return wRstTickMs;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t SchedWaitInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeWaiters = 0;
+  int32_t rRstWaiters = caps->read(arraySizeWaiters);
+  if (rRstWaiters != CAPS_SUCCESS) return rRstWaiters;
+  if (!waiters)
+    waiters = std::make_shared<std::vector<SchedWaitInfo>>();
+  else
+    waiters->clear();
+  for(int32_t i = 0; i < arraySizeWaiters;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      waiters->emplace_back();
+      int32_t dRst = waiters->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalWaitMs = caps->read(totalWaitMs);
+  if (rRstTotalWaitMs != CAPS_SUCCESS) return rRstTotalWaitMs;
+  int32_t rRstTickMs = caps->read(tickMs);
+  if (rRstTickMs != CAPS_SUCCESS) return rRstTickMs;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
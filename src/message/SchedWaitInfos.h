@@ -0,0 +1,97 @@
+#ifndef _SCHEDWAITINFOS_H
+#define _SCHEDWAITINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "SchedWaitInfo.h"
+namespace rokid {
+  /*
+   * processes waiting longest for cpu, from /proc/<pid>/schedstat
+   */
+  class SchedWaitInfos {
+  private:
+    std::shared_ptr<std::vector<SchedWaitInfo>> waiters = nullptr;
+    float totalWaitMs = 0;
+    float tickMs = 0;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<SchedWaitInfos> create() {
+      return std::make_shared<SchedWaitInfos>();
+    }
+    /*
+    * getter top waiters, longest wait first
+    */
+    inline const std::shared_ptr<std::vector<SchedWaitInfo>> getWaiters() const {
+      return waiters;
+    }
+    /*
+    * getter milliseconds all processes waited on runqueues in the tick
+    */
+    inline float getTotalWaitMs() const {
+      return totalWaitMs;
+    }
+    /*
+    * getter length of the tick in milliseconds
+    */
+    inline float getTickMs() const {
+      return tickMs;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter top waiters, longest wait first
+    */
+    inline void setWaiters(const std::shared_ptr<std::vector<SchedWaitInfo>> &v) {
+      this->waiters = v;
+    }
+    /*
+    * setter milliseconds all processes waited on runqueues in the tick
+    */
+    inline void setTotalWaitMs(float v) {
+      totalWaitMs = v;
+    }
+    /*
+    * setter length of the tick in milliseconds
+    */
+    inline void setTickMs(float v) {
+      tickMs = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _SCHEDWAITINFOS_H
\ No newline at end of file
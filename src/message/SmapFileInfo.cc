@@ -0,0 +1,118 @@
+#include "SmapFileInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t SmapFileInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SMAPFILEINFO));
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstPss = caps->write((int64_t)pss);
+  if (wRstPss != CAPS_SUCCESS) return wRstPss;
+  int32_t wRstRss = caps->write((int64_t)rss);
+  if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstProcesses = caps->write((int32_t)processes);
+  if (wRstProcesses != CAPS_SUCCESS) return wRstProcesses;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t SmapFileInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SMAPFILEINFO));
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstPss = caps->write((int64_t)pss);
+  if (wRstPss != CAPS_SUCCESS) return wRstPss;
+  int32_t wRstRss = caps->write((int64_t)rss);
+  if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstProcesses = caps->write((int32_t)processes);
+  if (wRstProcesses != CAPS_SUCCESS) return wRstProcesses;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t SmapFileInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstPss = caps->read(pss);
+  if (rRstPss != CAPS_SUCCESS) return rRstPss;
+  int32_t rRstRss = caps->read(rss);
+  if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstProcesses = caps->read(processes);
+  if (rRstProcesses != CAPS_SUCCESS) return rRstProcesses;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t SmapFileInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstPss = caps->read(pss);
+  if (rRstPss != CAPS_SUCCESS) return rRstPss;
+  int32_t rRstRss = caps->read(rss);
+  if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstProcesses = caps->read(processes);
+  if (rRstProcesses != CAPS_SUCCESS) return rRstProcesses;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t SmapFileInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstPath;
+  assert(path);
+  wRstPath = caps->write(path->c_str());
+  if (wRstPath != CAPS_SUCCESS) return wRstPath;
+  int32_t wRstPss = caps->write((int64_t)pss);
+  if (wRstPss != CAPS_SUCCESS) return wRstPss;
+  int32_t wRstRss = caps->write((int64_t)rss);
+  if (wRstRss != CAPS_SUCCESS) return wRstRss;
+  int32_t wRstSwap = caps->write((int64_t)swap);
+  if (wRstSwap != CAPS_SUCCESS) return wRstSwap;
+  int32_t wRstProcesses = caps->write((int32_t)processes);
+  if (wRstProcesses != CAPS_SUCCESS) return wRstProcesses;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t SmapFileInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!path) path = std::make_shared<std::string>();
+  int32_t rRstPath = caps->read_string(*path);
+  if (rRstPath != CAPS_SUCCESS) return rRstPath;
+  int32_t rRstPss = caps->read(pss);
+  if (rRstPss != CAPS_SUCCESS) return rRstPss;
+  int32_t rRstRss = caps->read(rss);
+  if (rRstRss != CAPS_SUCCESS) return rRstRss;
+  int32_t rRstSwap = caps->read(swap);
+  if (rRstSwap != CAPS_SUCCESS) return rRstSwap;
+  int32_t rRstProcesses = caps->read(processes);
+  if (rRstProcesses != CAPS_SUCCESS) return rRstProcesses;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,116 @@
+#ifndef _SMAPFILEINFO_H
+#define _SMAPFILEINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * memory of one mapped file summed over all processes
+   */
+  class SmapFileInfo {
+  private:
+    std::shared_ptr<std::string> path = nullptr;
+    int64_t pss = 0;
+    int64_t rss = 0;
+    int64_t swap = 0;
+    int32_t processes = 0;
+  public:
+    inline static std::shared_ptr<SmapFileInfo> create() {
+      return std::make_shared<SmapFileInfo>();
+    }
+    /*
+    * getter mapped file, or [anon], [heap], [stack]
+    */
+    inline const std::shared_ptr<std::string> getPath() const {
+      return path;
+    }
+    /*
+    * getter proportional set size in kB
+    */
+    inline int64_t getPss() const {
+      return pss;
+    }
+    /*
+    * getter resident set size in kB
+    */
+    inline int64_t getRss() const {
+      return rss;
+    }
+    /*
+    * getter swapped out size in kB
+    */
+    inline int64_t getSwap() const {
+      return swap;
+    }
+    /*
+    * getter processes mapping the file
+    */
+    inline int32_t getProcesses() const {
+      return processes;
+    }
+    /*
+    * setter mapped file, or [anon], [heap], [stack]
+    */
+    inline void setPath(const std::shared_ptr<std::string> &v) {
+      path = v;
+    }
+    /*
+    * setter mapped file, or [anon], [heap], [stack]
+    */
+    inline void setPath(const char* v) {
+      if (!path) path = std::make_shared<std::string>();
+      *path = v;
+    }
+    /*
+    * setter proportional set size in kB
+    */
+    inline void setPss(int64_t v) {
+      pss = v;
+    }
+    /*
+    * setter resident set size in kB
+    */
+    inline void setRss(int64_t v) {
+      rss = v;
+    }
+    /*
+    * setter swapped out size in kB
+    */
+    inline void setSwap(int64_t v) {
+      swap = v;
+    }
+    /*
+    * setter processes mapping the file
+    */
+    inline void setProcesses(int32_t v) {
+      processes = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _SMAPFILEINFO_H
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "SmapFileInfos.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t SmapFileInfos::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SMAPFILEINFOS));
+  if (!files)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)files->size());
+    for(auto &v : *files) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalPss = caps->write((int64_t)totalPss);
+  if (wRstTotalPss != CAPS_SUCCESS) return wRstTotalPss;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t SmapFileInfos::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SMAPFILEINFOS));
+  if (!files)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)files->size());
+    for(auto &v : *files) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalPss = caps->write((int64_t)totalPss);
+  if (wRstTotalPss != CAPS_SUCCESS) return wRstTotalPss;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t SmapFileInfos::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeFiles = 0;
+  int32_t rRstFiles = caps->read(arraySizeFiles);
+  if (rRstFiles != CAPS_SUCCESS) return rRstFiles;
+  if (!files)
+    files = std::make_shared<std::vector<SmapFileInfo>>();
+  else
+    files->clear();
+  for(int32_t i = 0; i < arraySizeFiles;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      files->emplace_back();
+      int32_t dRst = files->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalPss = caps->read(totalPss);
+  if (rRstTotalPss != CAPS_SUCCESS) return rRstTotalPss;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t SmapFileInfos::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeFiles = 0;
+  int32_t rRstFiles = caps->read(arraySizeFiles);
+  if (rRstFiles != CAPS_SUCCESS) return rRstFiles;
+  if (!files)
+    files = std::make_shared<std::vector<SmapFileInfo>>();
+  else
+    files->clear();
+  for(int32_t i = 0; i < arraySizeFiles;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      files->emplace_back();
+      int32_t dRst = files->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalPss = caps->read(totalPss);
+  if (rRstTotalPss != CAPS_SUCCESS) return rRstTotalPss;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t SmapFileInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!files)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)files->size());
+    for(auto &v : *files) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTotalPss = caps->write((int64_t)totalPss);
+  if (wRstTotalPss != CAPS_SUCCESS) return wRstTotalPss;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t SmapFileInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeFiles = 0;
+  int32_t rRstFiles = caps->read(arraySizeFiles);
+  if (rRstFiles != CAPS_SUCCESS) return rRstFiles;
+  if (!files)
+    files = std::make_shared<std::vector<SmapFileInfo>>();
+  else
+    files->clear();
+  for(int32_t i = 0; i < arraySizeFiles;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      files->emplace_back();
+      int32_t dRst = files->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTotalPss = caps->read(totalPss);
+  if (rRstTotalPss != CAPS_SUCCESS) return rRstTotalPss;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
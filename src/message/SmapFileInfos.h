@@ -0,0 +1,84 @@
+#ifndef _SMAPFILEINFOS_H
+#define _SMAPFILEINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "SmapFileInfo.h"
+namespace rokid {
+  /*
+   * mapped files with the most pss
+   */
+  class SmapFileInfos {
+  private:
+    std::shared_ptr<std::vector<SmapFileInfo>> files = nullptr;
+    int64_t totalPss = 0;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<SmapFileInfos> create() {
+      return std::make_shared<SmapFileInfos>();
+    }
+    /*
+    * getter largest pss first
+    */
+    inline const std::shared_ptr<std::vector<SmapFileInfo>> getFiles() const {
+      return files;
+    }
+    /*
+    * getter pss of all processes in kB
+    */
+    inline int64_t getTotalPss() const {
+      return totalPss;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter largest pss first
+    */
+    inline void setFiles(const std::shared_ptr<std::vector<SmapFileInfo>> &v) {
+      this->files = v;
+    }
+    /*
+    * setter pss of all processes in kB
+    */
+    inline void setTotalPss(int64_t v) {
+      totalPss = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _SMAPFILEINFOS_H
\ No newline at end of file
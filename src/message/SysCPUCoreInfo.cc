@@ -17,6 +17,12 @@ int32_t SysCPUCoreInfo::serialize(void* buf, uint32_t bufsize) const {
   if (wRstIoUsage != CAPS_SUCCESS) return wRstIoUsage;
   int32_t wRstBusyUsage = caps->write((float)busyUsage);
   if (wRstBusyUsage != CAPS_SUCCESS) return wRstBusyUsage;
+  int32_t wRstCapacityUsage = caps->write((float)capacityUsage);
+  if (wRstCapacityUsage != CAPS_SUCCESS) return wRstCapacityUsage;
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstOnline = caps->write((int32_t)online);
+  if (wRstOnline != CAPS_SUCCESS) return wRstOnline;
   return caps->serialize(buf, bufsize);
 }
 /*
@@ -36,6 +42,12 @@ int32_t SysCPUCoreInfo::serialize(std::shared_ptr<Caps> &caps) const {
   if (wRstIoUsage != CAPS_SUCCESS) return wRstIoUsage;
   int32_t wRstBusyUsage = caps->write((float)busyUsage);
   if (wRstBusyUsage != CAPS_SUCCESS) return wRstBusyUsage;
+  int32_t wRstCapacityUsage = caps->write((float)capacityUsage);
+  if (wRstCapacityUsage != CAPS_SUCCESS) return wRstCapacityUsage;
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstOnline = caps->write((int32_t)online);
+  if (wRstOnline != CAPS_SUCCESS) return wRstOnline;
   return CAPS_SUCCESS;
 }
 /*
@@ -55,6 +67,12 @@ int32_t SysCPUCoreInfo::deserialize(void* buf, uint32_t bufSize) {
   if (rRstIoUsage != CAPS_SUCCESS) return rRstIoUsage;
   int32_t rRstBusyUsage = caps->read(busyUsage);
   if (rRstBusyUsage != CAPS_SUCCESS) return rRstBusyUsage;
+  int32_t rRstCapacityUsage = caps->read(capacityUsage);
+  if (rRstCapacityUsage != CAPS_SUCCESS) return rRstCapacityUsage;
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstOnline = caps->read(online);
+  if (rRstOnline != CAPS_SUCCESS) return rRstOnline;
   return CAPS_SUCCESS;
 }
 /*
@@ -71,6 +89,12 @@ int32_t SysCPUCoreInfo::deserialize(std::shared_ptr<Caps> &caps) {
   if (rRstIoUsage != CAPS_SUCCESS) return rRstIoUsage;
   int32_t rRstBusyUsage = caps->read(busyUsage);
   if (rRstBusyUsage != CAPS_SUCCESS) return rRstBusyUsage;
+  int32_t rRstCapacityUsage = caps->read(capacityUsage);
+  if (rRstCapacityUsage != CAPS_SUCCESS) return rRstCapacityUsage;
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstOnline = caps->read(online);
+  if (rRstOnline != CAPS_SUCCESS) return rRstOnline;
   return CAPS_SUCCESS;
 }
 /*
@@ -88,6 +112,12 @@ int32_t SysCPUCoreInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
   if (wRstIoUsage != CAPS_SUCCESS) return wRstIoUsage;
   int32_t wRstBusyUsage = caps->write((float)busyUsage);
   if (wRstBusyUsage != CAPS_SUCCESS) return wRstBusyUsage;
+  int32_t wRstCapacityUsage = caps->write((float)capacityUsage);
+  if (wRstCapacityUsage != CAPS_SUCCESS) return wRstCapacityUsage;
+  int32_t wRstCpu = caps->write((int32_t)cpu);
+  if (wRstCpu != CAPS_SUCCESS) return wRstCpu;
+  int32_t wRstOnline = caps->write((int32_t)online);
+  if (wRstOnline != CAPS_SUCCESS) return wRstOnline;
   return CAPS_SUCCESS;
 }
 /*
@@ -104,6 +134,12 @@ int32_t SysCPUCoreInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
   if (rRstIoUsage != CAPS_SUCCESS) return rRstIoUsage;
   int32_t rRstBusyUsage = caps->read(busyUsage);
   if (rRstBusyUsage != CAPS_SUCCESS) return rRstBusyUsage;
+  int32_t rRstCapacityUsage = caps->read(capacityUsage);
+  if (rRstCapacityUsage != CAPS_SUCCESS) return rRstCapacityUsage;
+  int32_t rRstCpu = caps->read(cpu);
+  if (rRstCpu != CAPS_SUCCESS) return rRstCpu;
+  int32_t rRstOnline = caps->read(online);
+  if (rRstOnline != CAPS_SUCCESS) return rRstOnline;
   return CAPS_SUCCESS;
 }
 
@@ -15,6 +15,9 @@ namespace rokid {
     float idleUsage = 0;
     float ioUsage = 0;
     float busyUsage = 0;
+    float capacityUsage = 0;
+    int32_t cpu = 0;
+    int32_t online = 0;
   public:
     inline static std::shared_ptr<SysCPUCoreInfo> create() {
       return std::make_shared<SysCPUCoreInfo>();
@@ -50,6 +53,24 @@ namespace rokid {
       return busyUsage;
     }
     /*
+    * getter busy percent scaled by average over max frequency and by cpu_capacity
+    */
+    inline float getCapacityUsage() const {
+      return capacityUsage;
+    }
+    /*
+    * getter cpu id, -1 for the total of all cpus
+    */
+    inline int32_t getCpu() const {
+      return cpu;
+    }
+    /*
+    * getter 1 if online, the usages of an offline cpu are 0
+    */
+    inline int32_t getOnline() const {
+      return online;
+    }
+    /*
     * setter jiffy in user mode
     */
     inline void setUsrUsage(float v) {
@@ -79,6 +100,24 @@ namespace rokid {
     inline void setBusyUsage(float v) {
       busyUsage = v;
     }
+    /*
+    * setter busy percent scaled by average over max frequency and by cpu_capacity
+    */
+    inline void setCapacityUsage(float v) {
+      capacityUsage = v;
+    }
+    /*
+    * setter cpu id, -1 for the total of all cpus
+    */
+    inline void setCpu(int32_t v) {
+      cpu = v;
+    }
+    /*
+    * setter 1 if online, the usages of an offline cpu are 0
+    */
+    inline void setOnline(int32_t v) {
+      online = v;
+    }
     /*
      * serialize this object as buffer
     */
@@ -0,0 +1,133 @@
+#include "SysCounters.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t SysCounters::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SYSCOUNTERS));
+  int32_t wRstCtxtRate = caps->write((float)ctxtRate);
+  if (wRstCtxtRate != CAPS_SUCCESS) return wRstCtxtRate;
+  int32_t wRstIntrRate = caps->write((float)intrRate);
+  if (wRstIntrRate != CAPS_SUCCESS) return wRstIntrRate;
+  int32_t wRstSoftirqRate = caps->write((float)softirqRate);
+  if (wRstSoftirqRate != CAPS_SUCCESS) return wRstSoftirqRate;
+  int32_t wRstForkRate = caps->write((float)forkRate);
+  if (wRstForkRate != CAPS_SUCCESS) return wRstForkRate;
+  int32_t wRstProcsRunning = caps->write((uint32_t)procsRunning);
+  if (wRstProcsRunning != CAPS_SUCCESS) return wRstProcsRunning;
+  int32_t wRstProcsBlocked = caps->write((uint32_t)procsBlocked);
+  if (wRstProcsBlocked != CAPS_SUCCESS) return wRstProcsBlocked;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t SysCounters::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_SYSCOUNTERS));
+  int32_t wRstCtxtRate = caps->write((float)ctxtRate);
+  if (wRstCtxtRate != CAPS_SUCCESS) return wRstCtxtRate;
+  int32_t wRstIntrRate = caps->write((float)intrRate);
+  if (wRstIntrRate != CAPS_SUCCESS) return wRstIntrRate;
+  int32_t wRstSoftirqRate = caps->write((float)softirqRate);
+  if (wRstSoftirqRate != CAPS_SUCCESS) return wRstSoftirqRate;
+  int32_t wRstForkRate = caps->write((float)forkRate);
+  if (wRstForkRate != CAPS_SUCCESS) return wRstForkRate;
+  int32_t wRstProcsRunning = caps->write((uint32_t)procsRunning);
+  if (wRstProcsRunning != CAPS_SUCCESS) return wRstProcsRunning;
+  int32_t wRstProcsBlocked = caps->write((uint32_t)procsBlocked);
+  if (wRstProcsBlocked != CAPS_SUCCESS) return wRstProcsBlocked;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t SysCounters::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t rRstCtxtRate = caps->read(ctxtRate);
+  if (rRstCtxtRate != CAPS_SUCCESS) return rRstCtxtRate;
+  int32_t rRstIntrRate = caps->read(intrRate);
+  if (rRstIntrRate != CAPS_SUCCESS) return rRstIntrRate;
+  int32_t rRstSoftirqRate = caps->read(softirqRate);
+  if (rRstSoftirqRate != CAPS_SUCCESS) return rRstSoftirqRate;
+  int32_t rRstForkRate = caps->read(forkRate);
+  if (rRstForkRate != CAPS_SUCCESS) return rRstForkRate;
+  int32_t rRstProcsRunning = caps->read(procsRunning);
+  if (rRstProcsRunning != CAPS_SUCCESS) return rRstProcsRunning;
+  int32_t rRstProcsBlocked = caps->read(procsBlocked);
+  if (rRstProcsBlocked != CAPS_SUCCESS) return rRstProcsBlocked;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t SysCounters::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCtxtRate = caps->read(ctxtRate);
+  if (rRstCtxtRate != CAPS_SUCCESS) return rRstCtxtRate;
+  int32_t rRstIntrRate = caps->read(intrRate);
+  if (rRstIntrRate != CAPS_SUCCESS) return rRstIntrRate;
+  int32_t rRstSoftirqRate = caps->read(softirqRate);
+  if (rRstSoftirqRate != CAPS_SUCCESS) return rRstSoftirqRate;
+  int32_t rRstForkRate = caps->read(forkRate);
+  if (rRstForkRate != CAPS_SUCCESS) return rRstForkRate;
+  int32_t rRstProcsRunning = caps->read(procsRunning);
+  if (rRstProcsRunning != CAPS_SUCCESS) return rRstProcsRunning;
+  int32_t rRstProcsBlocked = caps->read(procsBlocked);
+  if (rRstProcsBlocked != CAPS_SUCCESS) return rRstProcsBlocked;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t SysCounters::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstCtxtRate = caps->write((float)ctxtRate);
+  if (wRstCtxtRate != CAPS_SUCCESS) return wRstCtxtRate;
+  int32_t wRstIntrRate = caps->write((float)intrRate);
+  if (wRstIntrRate != CAPS_SUCCESS) return wRstIntrRate;
+  int32_t wRstSoftirqRate = caps->write((float)softirqRate);
+  if (wRstSoftirqRate != CAPS_SUCCESS) return wRstSoftirqRate;
+  int32_t wRstForkRate = caps->write((float)forkRate);
+  if (wRstForkRate != CAPS_SUCCESS) return wRstForkRate;
+  int32_t wRstProcsRunning = caps->write((uint32_t)procsRunning);
+  if (wRstProcsRunning != CAPS_SUCCESS) return wRstProcsRunning;
+  int32_t wRstProcsBlocked = caps->write((uint32_t)procsBlocked);
+  if (wRstProcsBlocked != CAPS_SUCCESS) return wRstProcsBlocked;
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t SysCounters::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t rRstCtxtRate = caps->read(ctxtRate);
+  if (rRstCtxtRate != CAPS_SUCCESS) return rRstCtxtRate;
+  int32_t rRstIntrRate = caps->read(intrRate);
+  if (rRstIntrRate != CAPS_SUCCESS) return rRstIntrRate;
+  int32_t rRstSoftirqRate = caps->read(softirqRate);
+  if (rRstSoftirqRate != CAPS_SUCCESS) return rRstSoftirqRate;
+  int32_t rRstForkRate = caps->read(forkRate);
+  if (rRstForkRate != CAPS_SUCCESS) return rRstForkRate;
+  int32_t rRstProcsRunning = caps->read(procsRunning);
+  if (rRstProcsRunning != CAPS_SUCCESS) return rRstProcsRunning;
+  int32_t rRstProcsBlocked = caps->read(procsBlocked);
+  if (rRstProcsBlocked != CAPS_SUCCESS) return rRstProcsBlocked;
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,135 @@
+#ifndef _SYSCOUNTERS_H
+#define _SYSCOUNTERS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * system counters from /proc/stat
+   */
+  class SysCounters {
+  private:
+    float ctxtRate = 0;
+    float intrRate = 0;
+    float softirqRate = 0;
+    float forkRate = 0;
+    uint32_t procsRunning = 0;
+    uint32_t procsBlocked = 0;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<SysCounters> create() {
+      return std::make_shared<SysCounters>();
+    }
+    /*
+    * getter context switches per second
+    */
+    inline float getCtxtRate() const {
+      return ctxtRate;
+    }
+    /*
+    * getter interrupts per second
+    */
+    inline float getIntrRate() const {
+      return intrRate;
+    }
+    /*
+    * getter softirqs per second
+    */
+    inline float getSoftirqRate() const {
+      return softirqRate;
+    }
+    /*
+    * getter forks per second
+    */
+    inline float getForkRate() const {
+      return forkRate;
+    }
+    /*
+    * getter runnable processes
+    */
+    inline uint32_t getProcsRunning() const {
+      return procsRunning;
+    }
+    /*
+    * getter processes blocked on io
+    */
+    inline uint32_t getProcsBlocked() const {
+      return procsBlocked;
+    }
+    /*
+    * getter collect time
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter context switches per second
+    */
+    inline void setCtxtRate(float v) {
+      ctxtRate = v;
+    }
+    /*
+    * setter interrupts per second
+    */
+    inline void setIntrRate(float v) {
+      intrRate = v;
+    }
+    /*
+    * setter softirqs per second
+    */
+    inline void setSoftirqRate(float v) {
+      softirqRate = v;
+    }
+    /*
+    * setter forks per second
+    */
+    inline void setForkRate(float v) {
+      forkRate = v;
+    }
+    /*
+    * setter runnable processes
+    */
+    inline void setProcsRunning(uint32_t v) {
+      procsRunning = v;
+    }
+    /*
+    * setter processes blocked on io
+    */
+    inline void setProcsBlocked(uint32_t v) {
+      procsBlocked = v;
+    }
+    /*
+    * setter collect time
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _SYSCOUNTERS_H
\ No newline at end of file
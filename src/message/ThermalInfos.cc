@@ -0,0 +1,241 @@
+#include "ThermalInfos.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t ThermalInfos::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_THERMALINFOS));
+  if (!zones)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)zones->size());
+    for(auto &v : *zones) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!coolingDevices)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)coolingDevices->size());
+    for(auto &v : *coolingDevices) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t ThermalInfos::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_THERMALINFOS));
+  if (!zones)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)zones->size());
+    for(auto &v : *zones) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!coolingDevices)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)coolingDevices->size());
+    for(auto &v : *coolingDevices) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t ThermalInfos::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  int32_t arraySizeZones = 0;
+  int32_t rRstZones = caps->read(arraySizeZones);
+  if (rRstZones != CAPS_SUCCESS) return rRstZones;
+  if (!zones)
+    zones = std::make_shared<std::vector<ThermalZone>>();
+  else
+    zones->clear();
+  for(int32_t i = 0; i < arraySizeZones;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      zones->emplace_back();
+      int32_t dRst = zones->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeCoolingDevices = 0;
+  int32_t rRstCoolingDevices = caps->read(arraySizeCoolingDevices);
+  if (rRstCoolingDevices != CAPS_SUCCESS) return rRstCoolingDevices;
+  if (!coolingDevices)
+    coolingDevices = std::make_shared<std::vector<CoolingDevice>>();
+  else
+    coolingDevices->clear();
+  for(int32_t i = 0; i < arraySizeCoolingDevices;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      coolingDevices->emplace_back();
+      int32_t dRst = coolingDevices->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t ThermalInfos::deserialize(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeZones = 0;
+  int32_t rRstZones = caps->read(arraySizeZones);
+  if (rRstZones != CAPS_SUCCESS) return rRstZones;
+  if (!zones)
+    zones = std::make_shared<std::vector<ThermalZone>>();
+  else
+    zones->clear();
+  for(int32_t i = 0; i < arraySizeZones;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      zones->emplace_back();
+      int32_t dRst = zones->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeCoolingDevices = 0;
+  int32_t rRstCoolingDevices = caps->read(arraySizeCoolingDevices);
+  if (rRstCoolingDevices != CAPS_SUCCESS) return rRstCoolingDevices;
+  if (!coolingDevices)
+    coolingDevices = std::make_shared<std::vector<CoolingDevice>>();
+  else
+    coolingDevices->clear();
+  for(int32_t i = 0; i < arraySizeCoolingDevices;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      coolingDevices->emplace_back();
+      int32_t dRst = coolingDevices->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t ThermalInfos::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  if (!zones)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)zones->size());
+    for(auto &v : *zones) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  if (!coolingDevices)
+    caps->write((int32_t)0);
+  else {
+    caps->write((int32_t)coolingDevices->size());
+    for(auto &v : *coolingDevices) {
+      std::shared_ptr<Caps> c;
+      int32_t sRst = v.serializeForCapsObj(c);
+      if (sRst != CAPS_SUCCESS)
+      return sRst;
+      else {
+        int32_t wRst = caps->write(c);
+        if (wRst != CAPS_SUCCESS) return wRst;
+      }
+    }
+  }
+  int32_t wRstTimestamp = caps->write((int64_t)timestamp);
+  if (wRstTimestamp != CAPS_SUCCESS) return wRstTimestamp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t ThermalInfos::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  int32_t arraySizeZones = 0;
+  int32_t rRstZones = caps->read(arraySizeZones);
+  if (rRstZones != CAPS_SUCCESS) return rRstZones;
+  if (!zones)
+    zones = std::make_shared<std::vector<ThermalZone>>();
+  else
+    zones->clear();
+  for(int32_t i = 0; i < arraySizeZones;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      zones->emplace_back();
+      int32_t dRst = zones->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t arraySizeCoolingDevices = 0;
+  int32_t rRstCoolingDevices = caps->read(arraySizeCoolingDevices);
+  if (rRstCoolingDevices != CAPS_SUCCESS) return rRstCoolingDevices;
+  if (!coolingDevices)
+    coolingDevices = std::make_shared<std::vector<CoolingDevice>>();
+  else
+    coolingDevices->clear();
+  for(int32_t i = 0; i < arraySizeCoolingDevices;++i) {
+    std::shared_ptr<Caps> c;
+    if (caps->read(c) == CAPS_SUCCESS && c) {
+      coolingDevices->emplace_back();
+      int32_t dRst = coolingDevices->back().deserializeForCapsObj(c);
+      if (dRst != CAPS_SUCCESS) return dRst;
+    }
+  }
+  int32_t rRstTimestamp = caps->read(timestamp);
+  if (rRstTimestamp != CAPS_SUCCESS) return rRstTimestamp;
+  return CAPS_SUCCESS;
+}
+
@@ -0,0 +1,85 @@
+#ifndef _THERMALINFOS_H
+#define _THERMALINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "ThermalZone.h"
+#include "CoolingDevice.h"
+namespace rokid {
+  /*
+   * thermal zones and cooling devices
+   */
+  class ThermalInfos {
+  private:
+    std::shared_ptr<std::vector<ThermalZone>> zones = nullptr;
+    std::shared_ptr<std::vector<CoolingDevice>> coolingDevices = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<ThermalInfos> create() {
+      return std::make_shared<ThermalInfos>();
+    }
+    /*
+    * getter thermal zones
+    */
+    inline const std::shared_ptr<std::vector<ThermalZone>> getZones() const {
+      return zones;
+    }
+    /*
+    * getter cooling devices
+    */
+    inline const std::shared_ptr<std::vector<CoolingDevice>> getCoolingDevices() const {
+      return coolingDevices;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter thermal zones
+    */
+    inline void setZones(const std::shared_ptr<std::vector<ThermalZone>> &v) {
+      this->zones = v;
+    }
+    /*
+    * setter cooling devices
+    */
+    inline void setCoolingDevices(const std::shared_ptr<std::vector<CoolingDevice>> &v) {
+      this->coolingDevices = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _THERMALINFOS_H
\ No newline at end of file
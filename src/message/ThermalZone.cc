@@ -0,0 +1,103 @@
+#include "ThermalZone.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t ThermalZone::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_THERMALZONE));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstTemp = caps->write((int32_t)temp);
+  if (wRstTemp != CAPS_SUCCESS) return wRstTemp;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t ThermalZone::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_THERMALZONE));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstTemp = caps->write((int32_t)temp);
+  if (wRstTemp != CAPS_SUCCESS) return wRstTemp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t ThermalZone::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstTemp = caps->read(temp);
+  if (rRstTemp != CAPS_SUCCESS) return rRstTemp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t ThermalZone::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstTemp = caps->read(temp);
+  if (rRstTemp != CAPS_SUCCESS) return rRstTemp;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t ThermalZone::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstType;
+  assert(type);
+  wRstType = caps->write(type->c_str());
+  if (wRstType != CAPS_SUCCESS) return wRstType;
+  int32_t wRstTemp = caps->write((int32_t)temp);
+  if (wRstTemp != CAPS_SUCCESS) return wRstTemp;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t ThermalZone::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  if (!type) type = std::make_shared<std::string>();
+  int32_t rRstType = caps->read_string(*type);
+  if (rRstType != CAPS_SUCCESS) return rRstType;
+  int32_t rRstTemp = caps->read(temp);
+  if (rRstTemp != CAPS_SUCCESS) return rRstTemp;
+  return CAPS_SUCCESS;
+}
+
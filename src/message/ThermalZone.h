@@ -0,0 +1,97 @@
+#ifndef _THERMALZONE_H
+#define _THERMALZONE_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * one thermal zone of /sys/class/thermal
+   */
+  class ThermalZone {
+  private:
+    std::shared_ptr<std::string> name = nullptr;
+    std::shared_ptr<std::string> type = nullptr;
+    int32_t temp = 0;
+  public:
+    inline static std::shared_ptr<ThermalZone> create() {
+      return std::make_shared<ThermalZone>();
+    }
+    /*
+    * getter zone directory, e.g. thermal_zone0
+    */
+    inline const std::shared_ptr<std::string> getName() const {
+      return name;
+    }
+    /*
+    * getter zone type, e.g. cpu-thermal
+    */
+    inline const std::shared_ptr<std::string> getType() const {
+      return type;
+    }
+    /*
+    * getter temperature in millidegree Celsius
+    */
+    inline int32_t getTemp() const {
+      return temp;
+    }
+    /*
+    * setter zone directory, e.g. thermal_zone0
+    */
+    inline void setName(const std::shared_ptr<std::string> &v) {
+      name = v;
+    }
+    /*
+    * setter zone directory, e.g. thermal_zone0
+    */
+    inline void setName(const char* v) {
+      if (!name) name = std::make_shared<std::string>();
+      *name = v;
+    }
+    /*
+    * setter zone type, e.g. cpu-thermal
+    */
+    inline void setType(const std::shared_ptr<std::string> &v) {
+      type = v;
+    }
+    /*
+    * setter zone type, e.g. cpu-thermal
+    */
+    inline void setType(const char* v) {
+      if (!type) type = std::make_shared<std::string>();
+      *type = v;
+    }
+    /*
+    * setter temperature in millidegree Celsius
+    */
+    inline void setTemp(int32_t v) {
+      temp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _THERMALZONE_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "VmstatInfo.h"
+#include "MessageDefine.h"
+using namespace rokid;
+/*
+ * serialize this object as buffer
+*/
+int32_t VmstatInfo::serialize(void* buf, uint32_t bufsize) const {
+  std::shared_ptr<Caps> caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_VMSTATINFO));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstValue = caps->write((uint64_t)value);
+  if (wRstValue != CAPS_SUCCESS) return wRstValue;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return caps->serialize(buf, bufsize);
+}
+/*
+ * deserialize this object as caps (with message type)
+ */
+int32_t VmstatInfo::serialize(std::shared_ptr<Caps> &caps) const {
+  if (!caps)
+    caps = Caps::new_instance();
+  caps->write(static_cast<int32_t>(MessageType::TYPE_VMSTATINFO));
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstValue = caps->write((uint64_t)value);
+  if (wRstValue != CAPS_SUCCESS) return wRstValue;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from buffer
+ */
+int32_t VmstatInfo::deserialize(void* buf, uint32_t bufSize) {
+  std::shared_ptr<Caps> caps;
+  int32_t pRst = Caps::parse(buf, bufSize, caps);
+  if(pRst != CAPS_SUCCESS) return pRst;
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstValue = caps->read(value);
+  if (rRstValue != CAPS_SUCCESS) return rRstValue;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (with message type)
+ */
+int32_t VmstatInfo::deserialize(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstValue = caps->read(value);
+  if (rRstValue != CAPS_SUCCESS) return rRstValue;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * serialize this object as caps (without message type)
+ */
+int32_t VmstatInfo::serializeForCapsObj(std::shared_ptr<Caps> &caps) const {
+  caps = Caps::new_instance();
+  int32_t wRstName;
+  assert(name);
+  wRstName = caps->write(name->c_str());
+  if (wRstName != CAPS_SUCCESS) return wRstName;
+  int32_t wRstValue = caps->write((uint64_t)value);
+  if (wRstValue != CAPS_SUCCESS) return wRstValue;
+  int32_t wRstRate = caps->write((float)rate);
+  if (wRstRate != CAPS_SUCCESS) return wRstRate;
+  return CAPS_SUCCESS;
+}
+/*
+ * deserialize this object from caps (without message type)
+ */
+int32_t VmstatInfo::deserializeForCapsObj(std::shared_ptr<Caps> &caps) {
+  if (!name) name = std::make_shared<std::string>();
+  int32_t rRstName = caps->read_string(*name);
+  if (rRstName != CAPS_SUCCESS) return rRstName;
+  int32_t rRstValue = caps->read(value);
+  if (rRstValue != CAPS_SUCCESS) return rRstValue;
+  int32_t rRstRate = caps->read(rate);
+  if (rRstRate != CAPS_SUCCESS) return rRstRate;
+  return CAPS_SUCCESS;
+}
+
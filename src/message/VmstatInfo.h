@@ -0,0 +1,90 @@
+#ifndef _VMSTATINFO_H
+#define _VMSTATINFO_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+namespace rokid {
+  /*
+   * one counter of /proc/vmstat
+   */
+  class VmstatInfo {
+  private:
+    std::shared_ptr<std::string> name = nullptr;
+    uint64_t value = 0;
+    float rate = 0;
+  public:
+    inline static std::shared_ptr<VmstatInfo> create() {
+      return std::make_shared<VmstatInfo>();
+    }
+    /*
+    * getter counter name
+    */
+    inline const std::shared_ptr<std::string> getName() const {
+      return name;
+    }
+    /*
+    * getter counter value
+    */
+    inline uint64_t getValue() const {
+      return value;
+    }
+    /*
+    * getter increase per second since the previous sample
+    */
+    inline float getRate() const {
+      return rate;
+    }
+    /*
+    * setter counter name
+    */
+    inline void setName(const std::shared_ptr<std::string> &v) {
+      name = v;
+    }
+    /*
+    * setter counter name
+    */
+    inline void setName(const char* v) {
+      if (!name) name = std::make_shared<std::string>();
+      *name = v;
+    }
+    /*
+    * setter counter value
+    */
+    inline void setValue(uint64_t v) {
+      value = v;
+    }
+    /*
+    * setter increase per second since the previous sample
+    */
+    inline void setRate(float v) {
+      rate = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _VMSTATINFO_H
\ No newline at end of file
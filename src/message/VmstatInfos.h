@@ -0,0 +1,71 @@
+#ifndef _VMSTATINFOS_H
+#define _VMSTATINFOS_H
+#include <vector>
+#include <string>
+#include <memory>
+#include "caps.h"
+#include "VmstatInfo.h"
+namespace rokid {
+  /*
+   * paging, reclaim and oom counters from /proc/vmstat
+   */
+  class VmstatInfos {
+  private:
+    std::shared_ptr<std::vector<VmstatInfo>> counters = nullptr;
+    int64_t timestamp = 0;
+  public:
+    inline static std::shared_ptr<VmstatInfos> create() {
+      return std::make_shared<VmstatInfos>();
+    }
+    /*
+    * getter configured counters
+    */
+    inline const std::shared_ptr<std::vector<VmstatInfo>> getCounters() const {
+      return counters;
+    }
+    /*
+    * getter timestamp
+    */
+    inline int64_t getTimestamp() const {
+      return timestamp;
+    }
+    /*
+    * setter configured counters
+    */
+    inline void setCounters(const std::shared_ptr<std::vector<VmstatInfo>> &v) {
+      this->counters = v;
+    }
+    /*
+    * setter timestamp
+    */
+    inline void setTimestamp(int64_t v) {
+      timestamp = v;
+    }
+    /*
+     * serialize this object as buffer
+    */
+    int32_t serialize(void* buf, uint32_t bufsize) const;
+    /*
+     * deserialize this object as caps (with message type)
+     */
+    int32_t serialize(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from buffer
+     */
+    int32_t deserialize(void* buf, uint32_t bufSize);
+    /*
+     * deserialize this object from caps (with message type)
+     */
+    int32_t deserialize(std::shared_ptr<Caps> &caps);
+    /*
+     * serialize this object as caps (without message type)
+     */
+    int32_t serializeForCapsObj(std::shared_ptr<Caps> &caps) const;
+    /*
+     * deserialize this object from caps (without message type)
+     */
+    int32_t deserializeForCapsObj(std::shared_ptr<Caps> &caps);
+  };
+
+}
+#endif // _VMSTATINFOS_H
\ No newline at end of file
@@ -41,8 +41,12 @@ void Options::parseConf(const char *confpath) {
     }
     if (ite->value.IsString()) {
       cmdArgs.insert({key, ite->value.GetString()});
+    } else if (ite->value.IsDouble()) {
+      std::stringstream ss;
+      ss << ite->value.GetDouble();
+      cmdArgs.insert({key, ss.str()});
     } else {
-      ASSERT(ite->value.IsInt(), "%s is not string or int32", key);
+      ASSERT(ite->value.IsInt(), "%s is not string, int32 or double", key);
       cmdArgs.insert({key, std::to_string(ite->value.GetInt())});
     }
     continue;